@@ -0,0 +1,217 @@
+/*
+    Author: Maciej Cieslik, Hanna Biegacz
+
+    Benchmarks of the simulation hot paths (Google Benchmark). Lawn size benchmarks are parametrized
+    over square lawns from 100x100 cm up to MAX_LAWN_WIDTH x MAX_LAWN_LENGTH.
+
+    Usage: mower_bench [--benchmark_filter=<regex>] [--benchmark_out=results.json --benchmark_out_format=json]
+*/
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <utility>
+#include <vector>
+#include "BatchRunner.h"
+#include "Constants.h"
+#include "FileLogger.h"
+#include "Lawn.h"
+#include "Logger.h"
+#include "Mower.h"
+#include "Scenario.h"
+#include "StateInterpolator.h"
+#include "StateSimulation.h"
+
+using namespace std;
+
+
+namespace {
+    constexpr unsigned int BLADE_DIAMETER = 50; // cm
+    constexpr unsigned int SNAPSHOTS_NUMBER = 64;
+
+    void applyLawnSizes(benchmark::internal::Benchmark* benchmark) {
+        for (unsigned int size : {100u, 1000u, 5000u, Constants::MAX_LAWN_WIDTH}) {
+            benchmark->Arg(size);
+        }
+    }
+
+    void applyLawnSizesAndAngles(benchmark::internal::Benchmark* benchmark) {
+        for (unsigned int size : {100u, 1000u, Constants::MAX_LAWN_WIDTH}) {
+            for (int angle : {1, 30, 45, 89, 135, 210}) {
+                benchmark->Args({size, angle});
+            }
+        }
+    }
+
+    // Cuts a diagonal strip, so that about half of the lawn rows contain mowed fields
+    void cutDiagonal(Lawn& lawn) {
+        double size = lawn.getWidth();
+        vector<pair<double, double>> path;
+        for (double position = 0.0; position <= size; position += size / 16.0) {
+            path.push_back({position, position * lawn.getLength() / size});
+        }
+        lawn.cutGrassAlongPath(path, BLADE_DIAMETER);
+    }
+
+    // Figure eight from Main.cc (customUserLogic) scaled to the lawn size
+    Scenario createFigureEightScenario(const unsigned int& lawn_size) {
+        Scenario scenario;
+        scenario.name_ = "figure_eight";
+        scenario.lawn_width_ = lawn_size;
+        scenario.lawn_length_ = lawn_size;
+        scenario.mower_width_ = BLADE_DIAMETER;
+        scenario.mower_length_ = BLADE_DIAMETER;
+        scenario.blade_diameter_ = BLADE_DIAMETER;
+        scenario.mower_speed_ = 100;
+        scenario.log_filter_ = LogFilter::createErrorsOnly();
+
+        double first_radius = lawn_size * (0.55 - 0.29);
+        double second_radius = lawn_size * (0.75 - 0.55);
+        double first_step = first_radius * M_PI / 180.0;
+        double second_step = second_radius * M_PI / 180.0;
+
+        vector<ScenarioCommand>& commands = scenario.commands_;
+        commands.push_back({"add_point", {lawn_size * 0.5, lawn_size * 0.29}});
+        commands.push_back({"add_point", {lawn_size * 0.5, lawn_size * 0.55}});
+        commands.push_back({"add_point", {lawn_size * 0.5, lawn_size * 0.75}});
+        commands.push_back({"mowing", {0.0}});
+        commands.push_back({"move_to_point", {1.0}});
+
+        commands.push_back({"rotate_towards_point", {0.0}});
+        commands.push_back({"rotate", {90.0}});
+        commands.push_back({"mowing", {1.0}});
+        for (int i = 0; i < 360; ++i) {
+            commands.push_back({"move", {first_step}});
+            commands.push_back({"rotate", {-1.0}});
+        }
+
+        commands.push_back({"mowing", {0.0}});
+        commands.push_back({"move_to_point", {1.0}});
+        commands.push_back({"rotate_towards_point", {2.0}});
+        commands.push_back({"rotate", {-90.0}});
+        commands.push_back({"mowing", {1.0}});
+        for (int i = 0; i < 360; ++i) {
+            commands.push_back({"rotate", {1.0}});
+            commands.push_back({"move", {second_step}});
+        }
+        return scenario;
+    }
+}
+
+
+static void BM_LawnCutGrass(benchmark::State& state) {
+    unsigned int size = static_cast<unsigned int>(state.range(0));
+    Lawn lawn(size, size);
+    double x = 0.0;
+
+    for (auto _ : state) {
+        lawn.cutGrass({x, size * 0.5}, BLADE_DIAMETER);
+        x = x + 1.0 > size ? 0.0 : x + 1.0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LawnCutGrass)->Apply(applyLawnSizes);
+
+
+static void BM_LawnCutGrassSection(benchmark::State& state) {
+    unsigned int size = static_cast<unsigned int>(state.range(0));
+    Lawn lawn(size, size);
+    pair<double, double> beginning = {size * 0.25, size * 0.3};
+    pair<double, double> ending = {size * 0.75, size * 0.6};
+
+    for (auto _ : state) {
+        lawn.cutGrassSection(beginning, BLADE_DIAMETER, ending);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LawnCutGrassSection)->Apply(applyLawnSizes);
+
+
+static void BM_LawnCutGrassSectionTilted(benchmark::State& state) {
+    unsigned int size = static_cast<unsigned int>(state.range(0));
+    unsigned short angle = static_cast<unsigned short>(state.range(1));
+    Lawn lawn(size, size);
+    double length = size * 0.25;
+    pair<double, double> beginning = {size * 0.5, size * 0.5};
+    pair<double, double> ending = {beginning.first + length * sin(angle * M_PI / 180.0),
+        beginning.second + length * cos(angle * M_PI / 180.0)};
+
+    for (auto _ : state) {
+        lawn.cutGrassSection(beginning, BLADE_DIAMETER, ending);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LawnCutGrassSectionTilted)->Apply(applyLawnSizesAndAngles);
+
+
+static void BM_LawnCalculateShavedArea(benchmark::State& state) {
+    unsigned int size = static_cast<unsigned int>(state.range(0));
+    Lawn lawn(size, size);
+    cutDiagonal(lawn);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(lawn.calculateShavedArea());
+    }
+}
+BENCHMARK(BM_LawnCalculateShavedArea)->Apply(applyLawnSizes);
+
+
+static void BM_BuildSimulationSnapshot(benchmark::State& state) {
+    unsigned int size = static_cast<unsigned int>(state.range(0));
+    Lawn lawn(size, size);
+    Mower mower(BLADE_DIAMETER, BLADE_DIAMETER, BLADE_DIAMETER, 100);
+    Logger logger;
+    FileLogger file_logger("");
+    StateSimulation simulation(lawn, mower, logger, file_logger);
+    cutDiagonal(lawn);
+
+    for (auto _ : state) {
+        SimulationSnapshot snapshot = simulation.buildSimulationSnapshot();
+        benchmark::DoNotOptimize(snapshot);
+    }
+}
+BENCHMARK(BM_BuildSimulationSnapshot)->Apply(applyLawnSizes);
+
+
+static void BM_StateInterpolatorAddAndGet(benchmark::State& state) {
+    unsigned int size = static_cast<unsigned int>(state.range(0));
+    Lawn lawn(size, size);
+    Mower mower(BLADE_DIAMETER, BLADE_DIAMETER, BLADE_DIAMETER, 100);
+    Logger logger;
+    FileLogger file_logger("");
+    StateSimulation simulation(lawn, mower, logger, file_logger);
+    cutDiagonal(lawn);
+    SimulationSnapshot snapshot = simulation.buildSimulationSnapshot();
+
+    StateInterpolator interpolator;
+    double time = 0.0;
+    for (auto _ : state) {
+        for (unsigned int i = 0; i < SNAPSHOTS_NUMBER; ++i) {
+            snapshot.simulation_time_ = time;
+            snapshot.x_ = time * 0.001;
+            interpolator.addSimulationSnapshot(snapshot);
+
+            double render_time = time - Constants::SIMULATION_TIMESTEP * 500.0;
+            benchmark::DoNotOptimize(interpolator.getInterpolatedPose(render_time));
+            benchmark::DoNotOptimize(interpolator.getSnapshotAt(render_time));
+            time += Constants::SIMULATION_TIMESTEP * 1000.0;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * SNAPSHOTS_NUMBER);
+}
+BENCHMARK(BM_StateInterpolatorAddAndGet)->Apply(applyLawnSizes);
+
+
+static void BM_FigureEightScenario(benchmark::State& state) {
+    Scenario scenario = createFigureEightScenario(static_cast<unsigned int>(state.range(0)));
+
+    ScenarioResult result;
+    for (auto _ : state) {
+        result = BatchRunner::runScenario(scenario);
+    }
+    state.counters["coverage"] = result.coverage_;
+    state.counters["steps"] = static_cast<double>(result.steps_number_);
+}
+BENCHMARK(BM_FigureEightScenario)->Arg(800)->Arg(Constants::MAX_LAWN_WIDTH)->Unit(benchmark::kMillisecond);
+
+
+BENCHMARK_MAIN();
@@ -0,0 +1,36 @@
+/*
+    Author: Hanna Biegacz
+
+    Runs scenarios headless (without Engine and Visualizer). The simulation is stepped through MowerController
+    with the same fixed timestep as the Engine uses, but without waiting for the real time, so the scenario
+    is finished as fast as the CPU allows. Nobody renders the steps, so moves are resolved at once
+    (MowerController::updateUntil) - the result is the same as after the separate steps.
+    Many scenarios can be run in parallel - every scenario has its own simulation, so runs share no state.
+    Scenarios are split between worker threads and idle workers steal scenarios from the busy ones.
+*/
+
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Scenario.h"
+
+struct ScenarioResult {
+    std::string name_;
+    double coverage_ = 0.0; // ratio of mowed fields to all fields
+    uint64_t simulation_time_ = 0; // ms
+    double path_length_ = 0.0; // cm
+    double wall_time_ = 0.0; // ms
+    uint64_t steps_number_ = 0; // controller updates (a move resolved at once is one update)
+    uint64_t errors_number_ = 0; // error logs of the simulation (e.g. incorrect point id)
+    bool is_finished_ = false; // all commands were executed before the time limit
+    std::string error_;
+};
+
+class BatchRunner {
+public:
+    static ScenarioResult runScenario(const Scenario& scenario);
+    static std::vector<ScenarioResult> runScenarios(const std::vector<Scenario>& scenarios, 
+        const unsigned int& threads_number);
+    static std::string formatResult(const ScenarioResult& result);
+};
@@ -23,8 +23,11 @@ namespace Constants {
     inline constexpr unsigned int MIN_SPEED_DIVISION_FACTOR = 1000;
     inline constexpr unsigned int MAX_SPEED_DIVISION_FACTOR = 10;
     inline constexpr double DISTANCE_PRECISION = 0.001; // cm
+    inline constexpr double MAX_HORIZONTAL_EXCEEDANCE = DISTANCE_PRECISION; // max width of a mower's part, which is outside the lawn
+    inline constexpr double MAX_VERTICAL_EXCEEDANCE = DISTANCE_PRECISION; // max length of a mower's part, which is outside the lawn
     inline constexpr u_int64_t TICK_DURATION = 10; // ms
     inline constexpr unsigned int ROTATION_SPEED = 90; // degrees / s
+    inline constexpr double SIMULATION_TIMESTEP = 0.02; // s
     
     inline constexpr double PI = 3.14159265358979;
 }
@@ -4,14 +4,26 @@
     It runs the simulation loop in a separate thread (fixed timestep) and manages time speed. 
     It also handles synchronization (mutexes) to safely connect the 
     logic update with the visualization.
+    In free running mode the engine ignores the real time and executes fixed steps back to back,
+    publishing only every n-th snapshot for the visualization.
+    With event-driven simulation logic (setEventDrivenSimulationLogic) the engine does not tick: every call
+    of the logic jumps to the next event (e.g. the end of a move) and reports the time reached. In real time
+    mode the engine jumps from event to event through the due fixed steps, in free running mode it is not
+    limited at all, so long moves and idle periods cost one call. A snapshot is published at every event -
+    the visualization interpolates between them.
+    Tick durations, steps per wake-up, accumulator backlog and other runtime metrics are always collected
+    (see getMetrics) and can be periodically saved to a file.
 */
 
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <mutex>
+#include <string>
 #include <thread>
+#include "MetricsRegistry.h"
 #include "StateInterpolator.h"
 
 class StateSimulation;
@@ -32,17 +44,31 @@ public:
 
     void setSimulationSpeed(double multiplier);
     double getSpeedMultiplier() const;
+    void setFreeRunning(bool enabled);
+    bool isFreeRunning() const;
+    void setSnapshotDecimation(unsigned int steps);
+    unsigned int getSnapshotDecimation() const;
     double getSimulationTime() const; 
     StateInterpolator& getStateInterpolator();
+    const MetricsRegistry& getMetrics() const;
+    void setMetricsDump(const std::string& path, double interval_seconds);
 
     void setUserSimulationLogic(std::function<void(StateSimulation&, double)> callback);
     void setOnErrorCallback(std::function<void(const std::string&)> callback);
+    void setEventDrivenSimulationLogic(std::function<u_int64_t(StateSimulation&, double, u_int64_t)> callback);
+    bool isEventDriven() const;
     static void defaultSimulationLogic(StateSimulation& simulation, double dt);
 
 private:
     void runSimulation();
-    void updateSimulation(double dt);
+    void runRealTimeSteps(double& accumulator);
+    void runRealTimeEvents(double& accumulator);
+    void runFreeSteps();
+    bool tryUpdateSimulation(double dt, bool publish_snapshot, u_int64_t end_time = 0, 
+                             u_int64_t* reached_time = nullptr);
+    u_int64_t updateSimulation(double dt, bool publish_snapshot = true, u_int64_t end_time = 0);
     void processLogs(); 
+    void dumpMetrics(const std::chrono::steady_clock::time_point& current_time);
 
     StateSimulation& simulation_;
     StateInterpolator state_interpolator_;
@@ -50,8 +76,28 @@ private:
     std::mutex state_mutex_; 
     std::atomic<bool> running_;
     std::atomic<double> speed_multiplier_;
+    std::atomic<bool> free_running_;
+    std::atomic<unsigned int> snapshot_decimation_;
+    std::atomic<bool> event_driven_;
     const double fixed_timestep_; 
 
     std::function<void(StateSimulation&, double)> user_simulation_callback_;
     std::function<void(const std::string&)> error_callback_;
+    // (simulation, dt, end time in ms) -> simulation time reached
+    std::function<u_int64_t(StateSimulation&, double, u_int64_t)> event_driven_callback_;
+
+    MetricsRegistry metrics_;
+    LatencyHistogram& tick_duration_; // ns
+    LatencyHistogram& steps_per_wakeup_;
+    LatencyHistogram& accumulator_backlog_; // us
+    LatencyHistogram& snapshot_build_time_; // ns
+    LatencyHistogram& state_lock_wait_; // ns
+    LatencyHistogram& cut_fields_per_tick_;
+    MetricCounter& ticks_number_;
+    MetricCounter& clamped_frames_number_; // frames longer than MAX_FRAME_TIME_SECONDS - simulation falls behind
+    MetricCounter& log_bytes_written_;
+
+    std::string metrics_dump_path_; // empty means no dumping
+    std::chrono::steady_clock::duration metrics_dump_interval_;
+    std::chrono::steady_clock::time_point last_metrics_dump_time_;
 };
@@ -28,3 +28,23 @@ public:
 
     const char* what() const noexcept override;
 };
+
+
+class ScenarioParseError : public std::exception {
+private:
+    std::string msg;
+public:
+    explicit ScenarioParseError(const std::string& message);
+
+    const char* what() const noexcept override;
+};
+
+
+class CorruptLogRecordError : public std::exception {
+private:
+    std::string msg;
+public:
+    explicit CorruptLogRecordError(const std::string& message);
+
+    const char* what() const noexcept override;
+};
@@ -1,26 +1,61 @@
 /* 
     Author: Maciej Cieslik
     
-    Class, which handles saving logs to file.
+    Class, which handles saving logs to file. Logs are not written by the calling (simulation) thread - they are 
+    put into a lock-free ring buffer and a background writer thread saves them in batches to a file, which is 
+    kept open. All FileLoggers of one file (also created independently, e.g. by parallel simulations) share 
+    the same writer, so records are never interleaved. When the data is flushed to the disk is described 
+    by FlushPolicy; remaining logs are always flushed when the last logger of the file is destroyed.
+    Logs are saved as text or as binary LogEvent records (see LogEvent.h), which can be decoded with mower_logdump.
 */
 
 #pragma once
 
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include "Log.h"
+#include "LogEvent.h"
+
+
+struct FlushPolicy {
+    unsigned int flush_interval_ms_ = 100; // 0 meaning no periodic flushing
+    bool flush_on_error_ = true;
+};
+
+
+enum class LogFileFormat {
+    TEXT,
+    BINARY
+};
+
+
+class FileLogWriter;
 
 
 class FileLogger {
 private:
     std::string file_path_;
+    FlushPolicy flush_policy_;
+    LogFileFormat format_;
+    std::shared_ptr<FileLogWriter> writer_;
 public:
-    FileLogger(const std::string& path);
+    FileLogger(const std::string& path, const FlushPolicy& flush_policy = FlushPolicy(), 
+        const LogFileFormat& format = LogFileFormat::TEXT);
     FileLogger(const FileLogger& other);
     FileLogger& operator=(const FileLogger&) = delete;
 
     const std::string& getFilePath() const;
+    const FlushPolicy& getFlushPolicy() const;
+    const LogFileFormat& getFormat() const;
+    uint64_t getWrittenBytes() const;
     
     void saveLog(const Log& log) const;
+    void saveLog(Log&& log) const;
+    void saveError(const Log& log) const;
+    void saveError(Log&& log) const;
     void saveMessage(const std::string& message) const;
+    void saveEvent(const LogEvent& event) const;
+    void flush() const;
 };
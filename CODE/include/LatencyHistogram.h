@@ -0,0 +1,40 @@
+/*
+    Author: Hanna Biegacz
+
+    LatencyHistogram counts measured latencies (in nanoseconds) in power-of-two buckets: bucket i holds 
+    latencies in [2^(i-1), 2^i) ns. Recording is a few relaxed atomic operations, so it can be done on 
+    the simulation and GUI threads while another thread reads the statistics.
+*/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+class LatencyHistogram {
+public:
+    static constexpr size_t BUCKETS_NUMBER = 48;
+
+    LatencyHistogram();
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    void record(const uint64_t& nanoseconds);
+    void reset();
+
+    uint64_t getCount() const;
+    uint64_t getMax() const;
+    double getMean() const;
+    uint64_t getBucketCount(const size_t& bucket) const;
+    uint64_t getPercentile(const double& percentile) const;
+
+    static size_t calculateBucket(const uint64_t& nanoseconds);
+    static uint64_t getBucketUpperBound(const size_t& bucket);
+
+private:
+    std::array<std::atomic<uint64_t>, BUCKETS_NUMBER> buckets_;
+    std::atomic<uint64_t> count_;
+    std::atomic<uint64_t> total_;
+    std::atomic<uint64_t> max_;
+};
@@ -2,33 +2,60 @@
     Author: Maciej Cieslik
     
     Describes Lawn, on which mower is cutting grass. Lawn consists of fields, which are repesented by 
-    bool element in 2-dimensional vector. False meaning the grass is not cut, true meaning the grass is cut. 
+    single bits of bit-packed LawnGrid. False meaning the grass is not cut, true meaning the grass is cut. 
     Left down corner point has coordinates (0.0, 0.0).
+    Every cut, which mows at least one new field, increases lawn generation and records bounding box of changed 
+    fields, so consumers (snapshots, renderer) can process only regions changed since generation they have seen.
 */
 #pragma once
+#include <cstdint>
+#include <deque>
 #include <vector>
+#include "LawnGrid.h"
 
 class Lawn {
 private:
     unsigned int width_;
     unsigned int length_;
-    // Outer vector represents length(vertical), inner represents width(horizontal)
-    std::vector<std::vector<bool>> fields_; 
+    double field_width_; // cm
+    // Rows represent length(vertical), columns represent width(horizontal)
+    LawnGrid grid_;
 
-    bool isFieldInMowingArea(const double& x, const double& y, const std::pair<double, double>& blade_middle, 
-        const double& blade_diameter) const;
-    double calculateDistanceBetweenPoints(const double& x, const double& y, 
-        const std::pair<double, double>& destination_point) const;
-    unsigned int countCornersInArea(const double& x, const double& y, const std::pair<double, double>& blade_middle, 
-        const double& blade_diameter) const;
-    std::pair<double, double> calculateFirstMowingFieldCoords(const std::pair<double, double>& blade_middle, 
-        const double& blade_diameter) const;
-    void cutTiltedRectangle(const std::pair<double, double>& blade_middle_beginning, 
-        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
-        const unsigned short& angle);
-    void cutVerticalRectangle(const std::pair<double, double>& blade_middle_beginning, 
-        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending);
-    std::pair<double, double> calculateAdditionFactors(const unsigned short& angle);
+    struct DirtyRegion {
+        uint64_t generation_;
+        LawnRegion region_;
+    };
+    static constexpr unsigned int MAX_DIRTY_REGIONS_NUMBER = 1024;
+    uint64_t generation_;
+    // Regions changed in generations newer than this one are all stored in history
+    uint64_t oldest_tracked_generation_;
+    std::deque<DirtyRegion> dirty_regions_;
+    // Ranges of fields in the row cut by capsules, kept between cuts so cutting does not allocate memory
+    std::vector<std::pair<int64_t, int64_t>> row_ranges_;
+
+    bool isCornerInCircle(const int64_t& column, const int64_t& row, const std::pair<double, double>& blade_middle, 
+        const double& squared_radius) const;
+    std::pair<int64_t, int64_t> calculateCornersRangeInCircle(const int64_t& row, 
+        const std::pair<double, double>& blade_middle, const double& squared_radius, 
+        const std::pair<int64_t, int64_t>& previous_range) const;
+    void cutCircleBorderFields(const int64_t& row, const int64_t& first_column, const int64_t& last_column, 
+        const std::pair<int64_t, int64_t>& down_range, const std::pair<int64_t, int64_t>& up_range, 
+        const std::pair<double, double>& blade_middle, const double& squared_radius);
+    static std::pair<int64_t, int64_t> mergeCornersRanges(const std::pair<int64_t, int64_t>& first_range, 
+        const std::pair<int64_t, int64_t>& second_range);
+    static uint64_t calculateRangeMask(const int64_t& tile_first_column, 
+        const std::pair<int64_t, int64_t>& range);
+    static std::pair<double, double> calculateCapsuleSectionOnLine(const std::pair<double, double>& beginning, 
+        const std::pair<double, double>& ending, const double& radius, const double& y);
+    static std::pair<double, double> calculatePolygonSectionOnLine(const std::pair<double, double>* corners, 
+        const size_t& corners_number, const double& y);
+    int64_t calculateFirstFieldIndexAfter(const double& coord_value) const;
+    int64_t calculateLastFieldIndexBefore(const double& coord_value) const;
+    void markRegionAsDirty(const std::pair<unsigned int, unsigned int>& first_indexes, 
+        const std::pair<unsigned int, unsigned int>& last_indexes, const uint64_t& mowed_fields_before);
+    LawnRegion getWholeLawnRegion() const;
+    void cutCapsules(const std::pair<double, double>* path, const size_t& points_number, 
+        const unsigned int& blade_diameter);
 
 public:
     Lawn(const unsigned int& lawn_width, const unsigned int& lawn_length);
@@ -39,21 +66,25 @@ public:
 
     unsigned int getWidth() const;
     unsigned int getLength() const;
+    double getFieldWidth() const;
     std::vector<std::vector<bool>> getFields() const;
+    const LawnGrid& getGrid() const;
+    uint64_t getGeneration() const;
+    std::vector<LawnRegion> takeDirtyRegionsSince(const uint64_t& generation) const;
 
     bool isPointInLawn(const double& x, const double& y) const;
     std::pair<unsigned int, unsigned int> calculateFieldIndexes(const double& x, const double& y) const;
     void cutGrassOnField(const std::pair<unsigned int, unsigned int>& indexes);
 
     static bool countIfCoordInSection(const unsigned int& section_length, const double& coord_value);
-    static unsigned int calculateIndexInSection(const unsigned int& section_length, const double& coord_value, 
-        const unsigned int& vector_size);
+    unsigned int calculateIndexInSection(const unsigned int& section_length, const double& coord_value, 
+        const unsigned int& vector_size) const;
     
     double calculateShavedArea() const;
+    double calculateShavedArea(const std::pair<double, double>& left_down_corner, 
+        const std::pair<double, double>& right_up_corner) const;
     void cutGrass(const std::pair<double, double>& blade_middle, const unsigned int& blade_diameter);
     void cutGrassSection(const std::pair<double, double>& blade_middle_beginning, const unsigned int& blade_diameter,
-        const std::pair<double, double>& blade_middle_ending, const unsigned short& angle);
-    void cutRectangularGrass(const std::pair<double, double>& blade_middle_beginning, 
-        const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending,
-        const unsigned short& angle);
+        const std::pair<double, double>& blade_middle_ending);
+    void cutGrassAlongPath(const std::vector<std::pair<double, double>>& path, const unsigned int& blade_diameter);
 };
@@ -0,0 +1,84 @@
+/*
+    Author: Maciej Cieslik
+
+    Bit-packed storage of the lawn fields. Every field is represented by a single bit (false meaning the grass
+    is not cut, true meaning the grass is cut). Fields are grouped in square tiles of TILE_SIZE x TILE_SIZE
+    fields, where every row of a tile is a single 64-bit word, so cutting and counting work on whole words.
+    Tiles are reference-counted and copy-on-write: copying the grid (e.g. for a simulation snapshot) only
+    copies pointers, and a tile is cloned the first time it is cut while still shared with another grid.
+    Number of mowed fields is kept up to date (in total and per tile), so coverage queries do not rescan the grid.
+    Column 0, row 0 is the left down field of the lawn.
+*/
+
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Rectangular area of the grid described by indexes of fields (borders included)
+struct LawnRegion {
+    unsigned int first_column_ = 0;
+    unsigned int first_row_ = 0;
+    unsigned int last_column_ = 0;
+    unsigned int last_row_ = 0;
+
+    bool operator==(const LawnRegion& other) const {
+        return first_column_ == other.first_column_ && first_row_ == other.first_row_ &&
+            last_column_ == other.last_column_ && last_row_ == other.last_row_;
+    }
+
+    uint64_t countFields() const {
+        return static_cast<uint64_t>(last_column_ - first_column_ + 1) * static_cast<uint64_t>(last_row_ - first_row_ + 1);
+    }
+};
+
+
+class LawnGrid {
+public:
+    static constexpr unsigned int TILE_SIZE = 64;
+
+    LawnGrid();
+    LawnGrid(const unsigned int& columns_number, const unsigned int& rows_number);
+    bool operator==(const LawnGrid& other) const;
+    bool operator!=(const LawnGrid& other) const;
+
+    unsigned int getColumnsNumber() const;
+    unsigned int getRowsNumber() const;
+    unsigned int getHorizontalTilesNumber() const;
+    unsigned int getVerticalTilesNumber() const;
+    bool isEmpty() const;
+
+    bool getField(const unsigned int& column, const unsigned int& row) const;
+    uint64_t getTileRow(const unsigned int& tile_column, const unsigned int& row) const;
+    void setField(const unsigned int& column, const unsigned int& row);
+    void setFieldsInRow(const unsigned int& row, const unsigned int& first_column, const unsigned int& last_column);
+    void setFieldsInTileRow(const unsigned int& tile_column, const unsigned int& row, const uint64_t& mask);
+
+    bool hasSameTile(const LawnGrid& other, const unsigned int& tile_column, const unsigned int& tile_row) const;
+
+    uint64_t countSetFields() const;
+    unsigned int countSetFieldsInTile(const unsigned int& tile_column, const unsigned int& tile_row) const;
+    uint64_t countSetFieldsInArea(const unsigned int& first_column, const unsigned int& first_row,
+        const unsigned int& last_column, const unsigned int& last_row) const;
+    std::vector<std::vector<bool>> toFields() const;
+
+private:
+    struct Tile {
+        uint64_t rows_[TILE_SIZE] = {};
+        unsigned int set_fields_counter_ = 0;
+    };
+
+    unsigned int columns_number_;
+    unsigned int rows_number_;
+    unsigned int horizontal_tiles_number_;
+    unsigned int vertical_tiles_number_;
+    std::vector<std::shared_ptr<Tile>> tiles_;
+    uint64_t set_fields_counter_;
+
+    std::size_t calculateTileIndex(const unsigned int& tile_column, const unsigned int& tile_row) const;
+    Tile& getWritableTile(const unsigned int& tile_column, const unsigned int& tile_row);
+    void setBitsInWord(const unsigned int& tile_column, const unsigned int& row, const uint64_t& mask);
+    uint64_t countSetFieldsInTilePart(const unsigned int& tile_column, const unsigned int& first_row,
+        const unsigned int& last_row, const uint64_t& mask) const;
+    static uint64_t calculateBitsMask(const unsigned int& first_bit, const unsigned int& last_bit);
+};
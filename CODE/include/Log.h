@@ -1,8 +1,10 @@
 /* 
     Author: Maciej Cieslik
     
-    Each log represents error, for example: attempt of mowing outside the lawn. 
-    Log constists of simulation time when it occured and message.
+    Most logs represent errors, for example: attempt of mowing outside the lawn. Informational logs 
+    (e.g. arrival at a point) are marked as not being errors, so they are not flushed and counted as errors.
+    Log constists of simulation time when it occured, message and its severity.
+    Logs can only be moved, so passing them from StateSimulation through Logger to FileLogger never copies the message.
 */
 
 #pragma once
@@ -12,13 +14,19 @@ class Log {
 private:
     u_int64_t time_;
     std::string message_;
+    bool is_error_;
 public:
-    Log(const u_int64_t& time, const std::string& message);
-    Log(const Log& other);
-    Log& operator=(const Log&);
+    Log(const u_int64_t& time, const std::string& message, const bool& is_error = true);
+    Log(const u_int64_t& time, std::string&& message, const bool& is_error = true);
+    Log(const Log&) = delete;
+    Log& operator=(const Log&) = delete;
+    Log(Log&& other) noexcept = default;
+    Log& operator=(Log&& other) noexcept = default;
     bool operator==(const Log& other) const;
     bool operator!=(const Log& other) const;
 
     u_int64_t getTime() const;
-    std::string getMessage() const;
+    const std::string& getMessage() const;
+    bool isError() const;
+    std::string releaseMessage();
 };
\ No newline at end of file
@@ -0,0 +1,71 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Structured log event. Instead of formatting the message on the simulation thread, StateSimulation and 
+    commands save an event with its type, simulation time and typed payload (distance, x, y, angle, point id). 
+    The event is formatted to text only when it is needed (by the FileLogger writer thread or by mower_logdump).
+    
+    Binary log file starts with BINARY_LOG_HEADER, followed by fixed-size records (RECORD_SIZE bytes, 
+    native byte order):
+        type (1 byte) | flags (1 byte) | angle (2 bytes) | point id (4 bytes) | time (8 bytes) | 
+        distance (8 bytes) | x (8 bytes) | y (8 bytes)
+    Free text logs are saved as TEXT records, followed by the text of length stored in the point id field.
+    Records of unknown type or with text longer than MAX_TEXT_LENGTH or the rest of the file are corrupt.
+*/
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <string>
+
+enum class LogEventType : uint8_t {
+    TEXT = 0,
+    MOVEMENT,
+    MOVE_OUTSIDE_LAWN,
+    ROTATION,
+    INVALID_ROTATION,
+    MOWING_ON,
+    MOWING_OFF,
+    MOVEMENT_TO_POINT,
+    POINT_NOT_FOUND,
+    DISTANCE_TO_POINT,
+    DISTANCE_POINT_NOT_FOUND,
+    CURRENT_POSITION
+};
+
+struct LogEvent {
+    static constexpr char BINARY_LOG_HEADER[8] = {'M', 'O', 'W', 'L', 'O', 'G', '1', '\0'};
+    static constexpr size_t RECORD_SIZE = 40;
+    static constexpr uint32_t MAX_TEXT_LENGTH = 1 << 20;
+
+    LogEventType type_ = LogEventType::TEXT;
+    bool has_time_ = true;
+    int16_t angle_ = 0;
+    uint32_t point_id_ = 0;
+    u_int64_t time_ = 0;
+    double distance_ = 0.0;
+    double x_ = 0.0;
+    double y_ = 0.0;
+
+    static LogEvent createMovement(const u_int64_t& time, const double& distance, const double& x, const double& y);
+    static LogEvent createMoveOutsideLawn(const u_int64_t& time);
+    static LogEvent createRotation(const u_int64_t& time, const short& angle);
+    static LogEvent createInvalidRotation(const u_int64_t& time);
+    static LogEvent createMowingOption(const u_int64_t& time, const bool& is_mowing);
+    static LogEvent createMovementToPoint(const u_int64_t& time, const unsigned int& point_id);
+    static LogEvent createPointNotFound(const u_int64_t& time, const unsigned int& point_id);
+    static LogEvent createDistanceToPoint(const unsigned int& point_id, const double& distance);
+    static LogEvent createDistancePointNotFound(const unsigned int& point_id);
+    static LogEvent createCurrentPosition(const double& x, const double& y);
+
+    bool isError() const;
+    std::string formatMessage() const;
+    std::string formatLine() const;
+
+    void appendRecord(std::string& output) const;
+    static void appendTextRecord(std::string& output, const u_int64_t& time, const bool& has_time, 
+        const bool& is_error, const std::string& text);
+    static bool readRecord(std::istream& input, LogEvent& event, std::string& text);
+    static std::string formatLine(const u_int64_t& time, const bool& has_time, const std::string& message);
+};
@@ -0,0 +1,47 @@
+/*
+    Author: Maciej Cieslik
+
+    Per-category log levels. Every log of StateSimulation belongs to one category (motion, rotation, points
+    or errors) and has a level. Log is created only if its level is not lower than the level set for its
+    category, so the check is made before any message or event is built. For example, batch runs can keep
+    only errors by setting every other category to OFF.
+*/
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+enum class LogCategory : uint8_t {
+    MOTION = 0,
+    ROTATION,
+    POINTS,
+    ERRORS
+};
+
+enum class LogLevel : uint8_t {
+    INFO = 0,
+    ERROR,
+    OFF
+};
+
+class LogFilter {
+private:
+    static constexpr size_t CATEGORIES_NUMBER = 4;
+
+    std::array<LogLevel, CATEGORIES_NUMBER> levels_;
+public:
+    LogFilter(const LogLevel& level = LogLevel::INFO);
+    bool operator==(const LogFilter& other) const;
+    bool operator!=(const LogFilter& other) const;
+
+    static LogFilter createErrorsOnly();
+
+    const LogLevel& getLevel(const LogCategory& category) const;
+    void setLevel(const LogCategory& category, const LogLevel& level);
+
+    // Defined in the header, as it is called for every log on the simulation thread
+    bool isEnabled(const LogCategory& category, const LogLevel& level) const {
+        return level >= levels_[static_cast<size_t>(category)];
+    }
+};
@@ -0,0 +1,57 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Bounded lock-free queue of log entries with many producers and a single consumer. Producers (simulation
+    and engine threads) never block on a mutex - a slot is claimed with one atomic operation and published 
+    by its sequence number. The consumer is the FileLogger writer thread. Capacity is rounded up to the 
+    power of two.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include "LogEvent.h"
+
+struct LogEntry {
+    u_int64_t time_ = 0;
+    std::string message_;
+    bool has_time_ = false; // messages without time are saved as they are
+    bool is_error_ = false;
+    bool has_event_ = false; // structured event is saved instead of the message
+    LogEvent event_;
+
+    LogEntry() = default;
+    LogEntry(u_int64_t time, std::string message, bool has_time, bool is_error)
+        : time_(time), message_(std::move(message)), has_time_(has_time), is_error_(is_error) {}
+};
+
+class LogRingBuffer {
+private:
+    struct Cell {
+        std::atomic<size_t> sequence_;
+        LogEntry entry_;
+    };
+
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueue_position_;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeue_position_;
+
+public:
+    explicit LogRingBuffer(const size_t& capacity);
+    LogRingBuffer(const LogRingBuffer&) = delete;
+    LogRingBuffer& operator=(const LogRingBuffer&) = delete;
+
+    size_t getCapacity() const;
+    size_t getPushedNumber() const;
+    size_t getPoppedNumber() const;
+
+    bool tryPush(LogEntry& entry);
+    bool tryPop(LogEntry& entry);
+};
@@ -1,25 +1,48 @@
 /* 
     Author: Maciej Cieslik
     
-    Collects logs from StateSimulation in a queue. Each log represents error, for example: attempt of mowing
-    outside the lawn. Log constists of simulation time when it occured and message.
+    Collects logs from StateSimulation. Most logs represent errors, for example: attempt of mowing
+    outside the lawn. Log constists of simulation time when it occured, message and its severity.
+    Logs are consumed with drain(), which swaps the collected logs with a spare buffer and passes them 
+    to the consumer one by one. Both buffers keep their capacity, so draining logs on every tick 
+    does not allocate memory.
 */
 
 #pragma once
 #include <string>
-#include <queue>
+#include <utility>
+#include <vector>
 #include "Log.h"
 
 class Logger {
 private:
-    std::queue<Log> logs_;
+    std::vector<Log> logs_;
+    std::vector<Log> drained_logs_;
 public:
     Logger();
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
 
-    const std::queue<Log>& getLogs() const;
+    const std::vector<Log>& getLogs() const;
 
-    void push(const Log& newLog);
+    void push(Log&& newLog);
     void clear();
+
+    // Consumer is called with Log&& for every collected log, in the order they were pushed. 
+    // Logs pushed by the consumer are collected for the next drain. Returns number of drained logs.
+    template <typename Consumer>
+    size_t drain(Consumer&& consumer) {
+        if (logs_.empty()) {
+            return 0;
+        }
+
+        logs_.swap(drained_logs_);
+        for (Log& log : drained_logs_) {
+            consumer(std::move(log));
+        }
+
+        size_t drained_number = drained_logs_.size();
+        drained_logs_.clear();
+        return drained_number;
+    }
 };
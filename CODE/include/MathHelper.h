@@ -1,14 +1,114 @@
-/* 
+/*
     Author: Maciej Cieslik
-    
+
     Class which provides mathematical operations as static methods.
+    Angles of the mower are integer degrees, so sine, cosine and cotangent of every angle (0-359) are computed
+    at compile time and later read from tables - movement does not call trigonometric functions.
 */
 
+#pragma once
+#include <array>
+#include <cstddef>
+#include <limits>
+
+namespace TrigonometryTables {
+    inline constexpr size_t ANGLES_NUMBER = 360;
+    inline constexpr unsigned short RIGHT_ANGLE = 90;
+    inline constexpr unsigned short STRAIGHT_ANGLE = 180;
+    inline constexpr unsigned short HALF_RIGHT_ANGLE = 45;
+    inline constexpr int SERIES_TERMS_NUMBER = 12; // enough for double precision when |x| <= pi/4
+    // Full precision of double (Constants::PI is shorter), so that e.g. sine of 30 degrees is exactly 0.5
+    inline constexpr double PI = 3.14159265358979323846;
+    inline constexpr double DEGREES_TO_RADIANS = PI / STRAIGHT_ANGLE;
+
+    constexpr double calculateSinSeries(const double& x) {
+        double term = x;
+        double sum = x;
+        for (int i = 1; i <= SERIES_TERMS_NUMBER; ++i) {
+            term *= -x * x / ((2.0 * i) * (2.0 * i + 1.0));
+            sum += term;
+        }
+        return sum;
+    }
+
+    constexpr double calculateCosSeries(const double& x) {
+        double term = 1.0;
+        double sum = 1.0;
+        for (int i = 1; i <= SERIES_TERMS_NUMBER; ++i) {
+            term *= -x * x / ((2.0 * i - 1.0) * (2.0 * i));
+            sum += term;
+        }
+        return sum;
+    }
+
+    // Angle in [0, 360). Reduced to [0, 45] degrees by symmetries, so multiples of 90 degrees give exact 0 and 1
+    constexpr double calculateSin(const unsigned short& angle) {
+        unsigned short reduced_angle = angle;
+        double sign = 1.0;
+        if (reduced_angle > STRAIGHT_ANGLE) {
+            reduced_angle -= STRAIGHT_ANGLE;
+            sign = -1.0;
+        }
+        if (reduced_angle > RIGHT_ANGLE) {
+            reduced_angle = STRAIGHT_ANGLE - reduced_angle;
+        }
+        if (reduced_angle <= HALF_RIGHT_ANGLE) {
+            return sign * calculateSinSeries(reduced_angle * DEGREES_TO_RADIANS);
+        }
+        return sign * calculateCosSeries((RIGHT_ANGLE - reduced_angle) * DEGREES_TO_RADIANS);
+    }
+
+    constexpr std::array<double, ANGLES_NUMBER> createSinTable() {
+        std::array<double, ANGLES_NUMBER> table{};
+        for (size_t angle = 0; angle < ANGLES_NUMBER; ++angle) {
+            table[angle] = calculateSin(static_cast<unsigned short>(angle));
+        }
+        return table;
+    }
+
+    constexpr std::array<double, ANGLES_NUMBER> createCosTable() {
+        std::array<double, ANGLES_NUMBER> table{};
+        for (size_t angle = 0; angle < ANGLES_NUMBER; ++angle) {
+            table[angle] = calculateSin(static_cast<unsigned short>((angle + RIGHT_ANGLE) % ANGLES_NUMBER));
+        }
+        return table;
+    }
+
+    // Cotangent of 0 and 180 degrees is infinite (with the sign of cosine)
+    constexpr std::array<double, ANGLES_NUMBER> createCotTable() {
+        std::array<double, ANGLES_NUMBER> sin_table = createSinTable();
+        std::array<double, ANGLES_NUMBER> cos_table = createCosTable();
+        std::array<double, ANGLES_NUMBER> table{};
+        for (size_t angle = 0; angle < ANGLES_NUMBER; ++angle) {
+            if (sin_table[angle] == 0.0) {
+                table[angle] = cos_table[angle] > 0.0 ? std::numeric_limits<double>::infinity() :
+                    -std::numeric_limits<double>::infinity();
+            } else {
+                table[angle] = cos_table[angle] / sin_table[angle];
+            }
+        }
+        return table;
+    }
+
+    inline constexpr std::array<double, ANGLES_NUMBER> SIN = createSinTable();
+    inline constexpr std::array<double, ANGLES_NUMBER> COS = createCosTable();
+    inline constexpr std::array<double, ANGLES_NUMBER> COT = createCotTable();
+}
+
 class MathHelper {
 public:
     static double convertDegreesToRadians(const unsigned short& angle);
     static double convertRadiansToDegrees(const double& angle);
-    static double calculateAParameter(const unsigned short& angle);
-    static double calculateAPerpendicularParameter(const double& a_parameter);
     static double roundNumber(const double& value, const double& precision);
-};
\ No newline at end of file
+
+    // Defined in the header, as they are called on every movement step
+    static double getSin(const unsigned short& angle) {
+        return TrigonometryTables::SIN[angle % TrigonometryTables::ANGLES_NUMBER];
+    }
+    static double getCos(const unsigned short& angle) {
+        return TrigonometryTables::COS[angle % TrigonometryTables::ANGLES_NUMBER];
+    }
+    static double getCot(const unsigned short& angle) {
+        return TrigonometryTables::COT[angle % TrigonometryTables::ANGLES_NUMBER];
+    }
+};
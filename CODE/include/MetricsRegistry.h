@@ -0,0 +1,55 @@
+/*
+    Author: Hanna Biegacz
+
+    Named runtime metrics: counters and histograms (LatencyHistogram buckets, so every value is counted in
+    a power-of-two bucket). Metrics are registered once, before the hot path starts, and then updated through
+    the returned references with relaxed atomic operations - they are cheap enough to be always on.
+    All metrics can be written as text, one metric per line, e.g. for a periodic dump read by dashboards.
+*/
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include "LatencyHistogram.h"
+
+class MetricCounter {
+public:
+    MetricCounter() : value_(0) {}
+    MetricCounter(const MetricCounter&) = delete;
+    MetricCounter& operator=(const MetricCounter&) = delete;
+
+    void add(const uint64_t& value = 1) { value_.fetch_add(value, std::memory_order_relaxed); }
+    void set(const uint64_t& value) { value_.store(value, std::memory_order_relaxed); }
+    uint64_t get() const { return value_.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> value_;
+};
+
+class MetricsRegistry {
+public:
+    MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    MetricCounter& addCounter(const std::string& name);
+    LatencyHistogram& addHistogram(const std::string& name);
+
+    const MetricCounter* findCounter(const std::string& name) const;
+    const LatencyHistogram* findHistogram(const std::string& name) const;
+
+    void reset();
+    void writeMetrics(std::ostream& output) const;
+    bool saveMetrics(const std::string& path) const;
+
+private:
+    // Metrics are never removed, so references returned by add methods stay valid
+    mutable std::mutex metrics_mutex_;
+    std::map<std::string, std::unique_ptr<MetricCounter>> counters_;
+    std::map<std::string, std::unique_ptr<LatencyHistogram>> histograms_;
+};
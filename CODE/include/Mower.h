@@ -7,6 +7,7 @@
 */
 
 #pragma once
+#include <utility>
 
 
 class Mower {
@@ -16,6 +17,8 @@ private:
     unsigned int blade_diameter_; // cm
     unsigned int speed_; // cm/s
     unsigned short angle_; // (0-359) degree
+    double heading_x_; // unit vector of the movement direction, updated when the angle changes
+    double heading_y_;
     bool is_mowing_;
     double x_;
     double y_;
@@ -26,7 +29,8 @@ private:
 
 public:
     Mower(const unsigned int& width, const unsigned int& length, const unsigned int& blade_diameter,
-        const unsigned int& speed);
+        const unsigned int& speed, const double& starting_x = 0.0, const double& starting_y = 0.0, 
+        const unsigned short& starting_angle = 0);
     Mower(const Mower&) = delete;
     Mower& operator=(const Mower&) = delete;
     bool operator==(const Mower& other) const;
@@ -37,6 +41,8 @@ public:
     unsigned int getBladeDiameter() const;
     unsigned int getSpeed() const;
     unsigned short getAngle() const;
+    double getHeadingX() const;
+    double getHeadingY() const;
     bool getIsMowing() const;
     double getX() const;
     double getY() const;
@@ -4,6 +4,7 @@
     Manages a command queue for the lawn mower.
     Provides simple methods to control the mower (move, rotate, mowing on/off)
     and executes commands sequentially during simulation updates.
+    updateUntil is the event-driven update - it runs commands up to the next event at once.
 */
 
 #pragma once
@@ -44,6 +45,8 @@ public:
 
 
     void update(StateSimulation& sim, double dt);
+    u_int64_t updateUntil(StateSimulation& sim, double dt, u_int64_t end_time);
+    bool hasPendingCommands() const;
 
 private:
     std::queue<std::unique_ptr<ICommand>> command_queue_;
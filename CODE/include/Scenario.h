@@ -0,0 +1,80 @@
+/*
+    Author: Hanna Biegacz
+
+    Scenario describes a single headless simulation run: lawn size, mower parameters, starting pose and 
+    the command script for MowerController. ScenarioParser reads scenarios from a simple text format:
+
+        # comment
+        lawn 800 600                # width length [cm]
+        mower 50 50 50 100          # width length blade_diameter speed [cm, cm/s]
+        start 0 0 0                 # x y angle (optional, default 0 0 0)
+        max_time 3600               # simulated time limit [s] (optional)
+        log simulation_logs.log     # file for logs (optional, by default logs are dropped);
+                                    # "log simulation_logs.bin binary" saves binary log (see mower_logdump)
+        log_level motion off        # category (motion, rotation, points, errors, all) and the lowest
+                                    # logged level (info, error, off); optional, by default everything is logged
+        commands
+        mowing off
+        add_point 400 174
+        move_to_point 0
+        repeat 360
+            move 3.3
+            rotate -1
+        end
+
+    Available commands: move, rotate, mowing (on/off), add_point, delete_point, move_to_point, 
+    rotate_towards_point. Repeat blocks can be nested. Sizes, speed and point ids must be non-negative integers,
+    starting angle an integer from 0 to 359 and rotation an integer from -360 to 360.
+*/
+
+#pragma once
+#include <istream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "FileLogger.h"
+#include "LogFilter.h"
+
+class MowerController;
+
+struct ScenarioCommand {
+    std::string name_;
+    std::vector<double> arguments_;
+};
+
+struct Scenario {
+    std::string name_;
+    unsigned int lawn_width_ = 0;
+    unsigned int lawn_length_ = 0;
+    unsigned int mower_width_ = 0;
+    unsigned int mower_length_ = 0;
+    unsigned int blade_diameter_ = 0;
+    unsigned int mower_speed_ = 0;
+    double starting_x_ = 0.0;
+    double starting_y_ = 0.0;
+    unsigned short starting_angle_ = 0;
+    double max_simulation_time_ = 24.0 * 3600.0; // s
+    std::string log_path_;
+    LogFileFormat log_format_ = LogFileFormat::TEXT;
+    LogFilter log_filter_;
+    std::vector<ScenarioCommand> commands_;
+
+    void addCommandsTo(MowerController& controller) const;
+};
+
+class ScenarioParser {
+public:
+    static Scenario parseFile(const std::string& path);
+    static Scenario parse(std::istream& input, const std::string& name);
+
+private:
+    static void parseCommands(std::istream& input, const std::string& name, unsigned int& line_number, 
+        std::vector<ScenarioCommand>& commands, const bool& is_inside_repeat);
+    // Every argument must be in [min_value, max_value] and, if is_integer is set, it must be an integer
+    static std::vector<double> parseArguments(std::istream& line, const std::string& name, 
+        const unsigned int& line_number, const std::string& keyword, const size_t& arguments_number,
+        const double& min_value = std::numeric_limits<double>::lowest(), 
+        const double& max_value = std::numeric_limits<double>::max(), const bool& is_integer = false);
+    static std::string createErrorMessage(const std::string& name, const unsigned int& line_number, 
+        const std::string& message);
+};
@@ -5,10 +5,14 @@
     Used by StateInterpolator to perform smooth rendering without 
     repeatedly locking and accessing the main StateSimulation object.
     Contains mower position, lawn state, and points at a specific time.
+    Lawn state shares unchanged tiles with the simulation lawn, so building 
+    a snapshot copies only tile pointers instead of the whole lawn.
+    InterpolatedPose is the part of the snapshot, which changes every rendered frame.
 */
 
 #pragma once
 #include <vector>
+#include "LawnGrid.h"
 #include "Point.h"
 
 struct SimulationSnapshot { 
@@ -17,6 +21,14 @@ struct SimulationSnapshot {
     double angle_ = 0;
     double simulation_time_ = 0;
 
-    std::vector<std::vector<bool>> fields_;
+    LawnGrid lawn_grid_;
+    uint64_t lawn_generation_ = 0;
     std::vector<Point> points_;
 };
+
+struct InterpolatedPose {
+    double x_ = 0;
+    double y_ = 0;
+    double angle_ = 0;
+    double simulation_time_ = 0;
+};
@@ -0,0 +1,45 @@
+/*
+    Author: Hanna Biegacz
+
+    SnapshotChannel passes simulation snapshots from the simulation thread (single producer) to the GUI 
+    thread (single consumer) without locks. It is a bounded ring: the producer writes a slot and publishes 
+    it by moving the write position, the consumer moves the snapshot out and frees the slot by moving 
+    the read position. Neither side ever waits for the other. When the ring is full (the GUI is not reading), 
+    the newest snapshot is kept aside and published with the next push or flush, so the latest state is 
+    never lost - the producer calls flush when it has nothing new to push (e.g. when the simulation stops).
+*/
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include "SimulationSnapshot.h"
+
+class SnapshotChannel {
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+
+    std::unique_ptr<SimulationSnapshot[]> slots_;
+    size_t mask_;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> write_position_;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> read_position_;
+
+    // Producer only
+    alignas(CACHE_LINE_SIZE) SimulationSnapshot pending_snapshot_;
+    bool has_pending_snapshot_ = false;
+    std::atomic<size_t> replaced_number_;
+
+    bool tryPublish(SimulationSnapshot& snapshot);
+
+public:
+    explicit SnapshotChannel(const size_t& capacity);
+    SnapshotChannel(const SnapshotChannel&) = delete;
+    SnapshotChannel& operator=(const SnapshotChannel&) = delete;
+
+    size_t getCapacity() const;
+    size_t getReplacedNumber() const;
+
+    void push(SimulationSnapshot&& snapshot);
+    bool flush();
+    bool tryPop(SimulationSnapshot& snapshot);
+};
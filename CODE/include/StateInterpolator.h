@@ -5,14 +5,22 @@
     It saves a list of recent simulation snapshots of the simulation 
     and calculates the "in-between" positions for the animation. 
     This prevents the mower from jumping and teleporting.
+    Snapshots are passed from the simulation thread (the only caller of addSimulationSnapshot) to the GUI 
+    thread (the only caller of getters) through a lock-free SnapshotChannel, so neither thread blocks 
+    the other. The GUI thread keeps its own history of shared, read-only snapshots for interpolation.
+    Every frame only the pose is interpolated (getInterpolatedPose); the lawn and points are read 
+    through a handle to the snapshot (getSnapshotAt), so nothing is copied.
+    Latencies of publishing and reading snapshots are recorded in histograms.
 */
 
 #pragma once
 
 #include <atomic>
-#include <mutex>
 #include <deque>
+#include <memory>
+#include "LatencyHistogram.h"
 #include "SimulationSnapshot.h"
+#include "SnapshotChannel.h"
 
 struct StaticSimulationData {
     unsigned int lawn_width_ = 0;
@@ -25,40 +33,51 @@ struct StaticSimulationData {
 
 class StateInterpolator {
 public:
-    StateInterpolator() = default;
+    StateInterpolator();
     StateInterpolator(const StateInterpolator&) = delete;
     StateInterpolator& operator=(const StateInterpolator&) = delete;
 
     void addSimulationSnapshot( const SimulationSnapshot& sim_snapshot );
+    void addSimulationSnapshot( SimulationSnapshot&& sim_snapshot );
+    bool flushSimulationSnapshots();
+    InterpolatedPose getInterpolatedPose( double render_time ) const;
+    std::shared_ptr<const SimulationSnapshot> getSnapshotAt( double render_time ) const;
     SimulationSnapshot getInterpolatedState( double render_time ) const;
 
     double getSimulationTime() const;
     double getSpeedMultiplier() const;
     const StaticSimulationData& getStaticSimulationData() const;
+    const LatencyHistogram& getPublishLatency() const;
+    const LatencyHistogram& getReadLatency() const;
 
     void setSimulationSpeedMultiplier(double speed_multiplier);
     void setStaticSimulationData(const StaticSimulationData& data);
 private:
     StaticSimulationData static_simulation_data;
-    std::deque<SimulationSnapshot> sim_snapshot_buffer_;
+    mutable SnapshotChannel snapshot_channel_; // getters collect new snapshots from the channel
+    mutable std::deque<std::shared_ptr<const SimulationSnapshot>> sim_snapshot_buffer_; // GUI thread only
     std::atomic<double> current_speed_multiplier_{1.0};
-    mutable std::mutex mutex_;
+    LatencyHistogram publish_latency_;
+    mutable LatencyHistogram read_latency_;
     
     static const size_t MAX_BUFFER_SIZE = 50;
+    static constexpr size_t CHANNEL_CAPACITY = 64;
 
-    void storeSnapshot( const SimulationSnapshot& snapshot );
-    void enforceBufferSizeLimit();
+    void collectSnapshots() const;
+    void storeSnapshot( SimulationSnapshot&& snapshot ) const;
+    void enforceBufferSizeLimit() const;
     bool isSnapshotOutdated( const SimulationSnapshot& snapshot ) const;
-    bool tryUpdateExistingSnapshot(const SimulationSnapshot& snapshot);
+    bool tryUpdateExistingSnapshot( SimulationSnapshot& snapshot ) const;
 
 
-    SimulationSnapshot computeInterpolatedSnapshot( double render_time ) const;
-    SimulationSnapshot blendSnapshots( const SimulationSnapshot& start, const SimulationSnapshot& end, double alpha, double render_time ) const;
+    InterpolatedPose computeInterpolatedPose( double render_time ) const;
+    InterpolatedPose blendSnapshots( const SimulationSnapshot& start, const SimulationSnapshot& end, double alpha, double render_time ) const;
+    static InterpolatedPose getPose( const SimulationSnapshot& snapshot );
     double calculateInterpolationAlpha( const SimulationSnapshot& before, const SimulationSnapshot& after, double render_time ) const;
     static double interpolate( double a, double b, double alpha );
     static double interpolateAngle( double start_angle, double end_angle, double alpha );
 
     bool shouldReturnEarliestSnapshot( double render_time ) const;
     bool shouldReturnLatestSnapshot( double render_time ) const;
-    std::deque<SimulationSnapshot>::const_iterator findFirstSnapshotAfter( double time ) const;
+    std::deque<std::shared_ptr<const SimulationSnapshot>>::const_iterator findFirstSnapshotAfter( double time ) const;
 };
@@ -4,6 +4,8 @@
     Handles simulation state. StateSimulation is responsible for changing state of the world 
     by manipulating the mower and the lawn. Calculates simulation time and creates lightweight 
     snapshots for the interpolator (to minimize locking time and build a history buffer for smooth animation).
+    Simulation keeps no process-wide state, so independent simulations can run concurrently in one process.
+    Logs are created only when they pass the simulation's LogFilter.
 
 */
 
@@ -14,6 +16,7 @@
 #include "Logger.h"
 #include "Mower.h"
 #include "FileLogger.h"
+#include "LogFilter.h"
 #include "StateInterpolator.h"
 
 class StateSimulation {
@@ -25,11 +28,11 @@ private:
     std::vector<Point> points_;
     unsigned int next_point_id_;
     FileLogger file_logger_;
+    LogFilter log_filter_;
 
-    double countDistanceToBorder(const double& distance) const;
-    std::pair<double, double> countBorderPoint() const;
-    void calculateMovementTime(const double& distance);  
-    void calculateRotationTime(const short& angle);
+    u_int64_t calculateMovementDuration(const double& distance) const;
+    double calculateDistanceInsideLawn() const;
+    void moveMower(const double& distance, const u_int64_t& duration);
     void moveToPointAttempt(const double& x, const double& y);
     std::pair<short, double> calculateAngleAndDistance(const double& x, const double& y) const;
     double calculateRotationNoDx(const double& dy) const;
@@ -51,13 +54,20 @@ public:
     const unsigned int& getNextPointId() const;
     StaticSimulationData getStaticData() const;
     const FileLogger& getFileLogger() const;
+    const LogFilter& getLogFilter() const;
+    void setLogFilter(const LogFilter& log_filter);
     void logArrivalAtPoint(unsigned int pointId);
     SimulationSnapshot buildSimulationSnapshot() const;
     std::optional<std::pair<double, double>> getPointCoordinates(unsigned int pointId);
     std::pair<short, double> calculateNavigationVector(double targetX, double targetY) const; 
+    u_int64_t calculateRotationDuration(const short& angle) const;
 
     void simulateMovement(const double& distance);
+    double simulateMovementInSteps(const double& distance, const double& step, const u_int64_t& end_time);
     void simulateRotation(const short& angle);
+    void simulateRotation(const short& angle, const u_int64_t& duration);
+    short simulateRotationInSteps(const short& angle, const double& step, double& accumulator, 
+        const u_int64_t& end_time);
     void simulateMowingOptionOn();
     void simulateMowingOptionOff();
     void simulateAddPoint(const double& x, const double& y);
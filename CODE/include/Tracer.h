@@ -0,0 +1,110 @@
+/*
+    Author: Hanna Biegacz
+
+    Hot-path tracing. TRACE_SCOPE(name) measures the enclosing scope and records it as one trace event.
+    Every thread writes to its own buffer without any locks (the mutex is taken only once per thread, when
+    its buffer is registered). Recorded events can be saved in the Chrome trace-event JSON format and opened
+    in Perfetto or chrome://tracing, where the simulation and GUI threads are shown side by side.
+
+    Tracing is compiled in only with MOWER_TRACING defined (cmake -DMOWER_TRACING=ON). Otherwise TRACE_SCOPE
+    expands to nothing and the hot paths are not affected at all.
+*/
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct TraceEvent {
+    const char* name_ = nullptr; // string literal, only the pointer is stored
+    uint64_t start_ = 0; // ns since the start of the tracer
+    uint64_t duration_ = 0; // ns
+};
+
+// Events recorded by one thread. Only the owner thread writes, so the buffer is a single-producer log:
+// the event is written first and then published by incrementing the size. Memory is allocated in chunks,
+// when the previous chunk is full. Events above the capacity are dropped (and counted).
+class TraceBuffer {
+public:
+    static constexpr size_t CHUNK_SIZE = 4096;
+    static constexpr size_t MAX_CHUNKS_NUMBER = 256;
+    static constexpr size_t CAPACITY = CHUNK_SIZE * MAX_CHUNKS_NUMBER;
+
+    explicit TraceBuffer(const uint32_t& thread_id);
+    TraceBuffer(const TraceBuffer&) = delete;
+    TraceBuffer& operator=(const TraceBuffer&) = delete;
+
+    bool push(const TraceEvent& event);
+
+    size_t getSize() const;
+    const TraceEvent& getEvent(const size_t& index) const;
+    uint64_t getDroppedNumber() const;
+    const uint32_t& getThreadId() const;
+    const std::string& getThreadName() const;
+    void setThreadName(const std::string& thread_name);
+
+private:
+    std::array<std::unique_ptr<TraceEvent[]>, MAX_CHUNKS_NUMBER> chunks_;
+    std::atomic<size_t> size_;
+    std::atomic<uint64_t> dropped_number_;
+    const uint32_t thread_id_;
+    std::string thread_name_;
+};
+
+class Tracer {
+public:
+    static Tracer& getInstance();
+
+    Tracer(const Tracer&) = delete;
+    Tracer& operator=(const Tracer&) = delete;
+
+    uint64_t getTimestamp() const;
+    void record(const char* name, const uint64_t& start, const uint64_t& end);
+    void setThreadName(const std::string& thread_name);
+
+    size_t getEventsNumber() const;
+    uint64_t getDroppedNumber() const;
+    void writeChromeTrace(std::ostream& output) const;
+    bool saveChromeTrace(const std::string& path) const;
+
+private:
+    Tracer();
+    TraceBuffer& getThreadBuffer();
+
+    const uint64_t start_time_;
+    mutable std::mutex buffers_mutex_;
+    std::vector<std::unique_ptr<TraceBuffer>> buffers_; // never removed, so threads can keep the pointers
+};
+
+// Records the time between its construction and destruction
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : name_(name), start_(Tracer::getInstance().getTimestamp()) {}
+    ~TraceScope() {
+        Tracer& tracer = Tracer::getInstance();
+        tracer.record(name_, start_, tracer.getTimestamp());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name_;
+    const uint64_t start_;
+};
+
+#ifdef MOWER_TRACING
+#define TRACE_CONCATENATE_IMPL(first, second) first##second
+#define TRACE_CONCATENATE(first, second) TRACE_CONCATENATE_IMPL(first, second)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCATENATE(trace_scope_, __LINE__)(name)
+#define TRACE_THREAD_NAME(name) Tracer::getInstance().setThreadName(name)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+#endif
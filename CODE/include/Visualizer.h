@@ -13,6 +13,8 @@
 #include <QTimer>
 #include <QElapsedTimer>
 #include <QPixmap>
+#include <QImage>
+#include <memory>
 #include <vector>
 #include "RenderTimeController.h"
 #include "StateInterpolator.h"
@@ -44,11 +46,15 @@ private:
     static const QColor MOWED_GRASS_COLOR;
 
     StateInterpolator& state_interpolator_;
-    SimulationSnapshot current_sim_snapshot_;
+    InterpolatedPose current_pose_;
+    std::shared_ptr<const SimulationSnapshot> current_sim_snapshot_;
+    std::shared_ptr<const SimulationSnapshot> rendered_sim_snapshot_;
     RenderTimeController render_time_controller_;
     StaticSimulationData static_simulation_data_;
     std::vector<QPixmap> point_pixmaps_;
     QPixmap mower_image_;
+    QImage lawn_image_;
+    LawnGrid rendered_lawn_grid_;
     QPointF map_offset_;
     QElapsedTimer frame_timer_;
     double scale_factor_ = 1.0;
@@ -60,8 +66,10 @@ private:
     void updateLayout();
     void loadMowerImage();
     void loadPointImages();
+    void updateLawnImage();
+    void updateLawnImageTile(const LawnGrid& grid, unsigned int tile_column, unsigned int tile_row);
     void renderLawn(QPainter& painter) const;
-    void renderMower(QPainter& painter, const SimulationSnapshot& sim_snapshot) const;
+    void renderMower(QPainter& painter, const InterpolatedPose& pose) const;
     void renderPoints(QPainter& painter) const;
     QPointF mapToScreen(double x_cm, double y_cm) const;
 
@@ -5,6 +5,8 @@
     ICommand is an abstract base class for all commands.
     It defines the execute method that is called to execute the command.
     ICommand is used to execute commands in the simulation.
+    executeUntil runs the command in steps of dt in one call (up to the given simulation time), which is used
+    in headless mode. By default it makes a single step; commands, which can be resolved at once, override it.
 */
 
 #pragma once
@@ -16,6 +18,7 @@ public:
     ICommand() {} 
     virtual ~ICommand() = default;
     virtual bool execute(StateSimulation& sim, double dt) = 0;
+    virtual bool executeUntil(StateSimulation& sim, double dt, u_int64_t /*end_time*/) { return execute(sim, dt); }
     ICommand(const ICommand&) = delete;
     ICommand& operator=(const ICommand&) = delete;
 };
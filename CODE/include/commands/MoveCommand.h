@@ -4,6 +4,7 @@
     Command to move the mower by a specified distance.
     Implements ICommand interface.
     Supports both immediate and deferred distance calculation with scaling.
+    In headless mode the whole distance (or the part before the end time) is moved at once.
 */
 
 
@@ -15,11 +16,14 @@ public:
     explicit MoveCommand(double distance);
     MoveCommand(const double* distance_ptr, double scale);
     bool execute(StateSimulation& sim, double dt) override;
+    bool executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) override;
 
     MoveCommand(const MoveCommand&) = delete;
     MoveCommand& operator=(const MoveCommand&) = delete;
 
 private:
+    void initializeDistance();
+
     double distance_left_;
     const double* deferred_distance_ = nullptr;
     double scale_ = 1.0;
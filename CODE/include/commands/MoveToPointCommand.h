@@ -5,6 +5,8 @@
     Implements ICommand interface.
     Executes over multiple frames: first rotates the mower to face the target,
     then moves forward until arrival.
+    In headless mode every leg is resolved at once: the mower rotates to face the target and moves straight
+    towards it, until arrival (or the end time). Long legs, which would miss the target, are split in halves.
 */
 
 #pragma once
@@ -14,6 +16,7 @@ class MoveToPointCommand : public ICommand {
 public:
     explicit MoveToPointCommand(unsigned int pointId);
     bool execute(StateSimulation& sim, double dt) override;
+    bool executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) override;
 
     MoveToPointCommand(const MoveToPointCommand&) = delete;
     MoveToPointCommand& operator=(const MoveToPointCommand&) = delete;
@@ -31,6 +34,7 @@ private:
     void executeMovementLogic(StateSimulation& sim, double dt, double distanceToTarget);
 
     double calculateDistanceToTarget(const StateSimulation& sim) const;
+    double calculateLegLength(const StateSimulation& sim) const;
     bool hasArrivedAtTarget(StateSimulation& sim, double currentDistance) const;
     bool isAlignedWithTarget(short rotationNeeded, double distanceToTarget) const;
 };
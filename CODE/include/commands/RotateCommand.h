@@ -4,6 +4,7 @@
     Command to rotate the mower by a specified angle (degrees).
     Implements ICommand interface.
     Executes over multiple frames at a controlled rotation speed until complete.
+    In headless mode the frames until the end time (or the end of the rotation) are rotated at once.
 */
 
 #pragma once
@@ -13,6 +14,7 @@ class RotateCommand : public ICommand {
 public:
     explicit RotateCommand(short angle);
     bool execute(StateSimulation& sim, double dt) override;
+    bool executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) override;
 
     RotateCommand(const RotateCommand&) = delete;
     RotateCommand& operator=(const RotateCommand&) = delete;
@@ -22,6 +24,7 @@ private:
 
     double calculateRotationStepForFrame(double dt) const;
     void updateInternalRotationState(double step);
+    short takeAccumulatedRotation();
     void applyAccumulatedRotationToSimulation(StateSimulation& sim);
     bool isRotationFinished() const;
 };
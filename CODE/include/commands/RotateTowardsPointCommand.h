@@ -4,6 +4,7 @@
     Command to rotate the mower towards a specific point.
     Implements ICommand interface.
     Executes over multiple frames at a controlled rotation speed until alignment with target point.
+    In headless mode the frames are rotated at once, until the mower faces the point (or the end time).
 */
 
 #pragma once
@@ -13,6 +14,7 @@ class RotateTowardsPointCommand : public ICommand {
 public:
     explicit RotateTowardsPointCommand(unsigned int pointId);
     bool execute(StateSimulation& sim, double dt) override;
+    bool executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) override;
 
     RotateTowardsPointCommand(const RotateTowardsPointCommand&) = delete;
     RotateTowardsPointCommand& operator=(const RotateTowardsPointCommand&) = delete;
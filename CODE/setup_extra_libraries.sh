@@ -3,6 +3,7 @@ set -e
 
 PROJECT_DIR=$(pwd)
 GTEST_DIR="$PROJECT_DIR/libs/googletest"
+BENCHMARK_DIR="$PROJECT_DIR/libs/benchmark"
 
 echo "=== Project extra libraries setup ==="
 echo
@@ -54,7 +55,17 @@ else
 fi
 
 echo
-echo "IV. Installing Doxygen (for documentation generation)..."
+echo "IV. Configuring Google Benchmark..."
+if [ -d "$BENCHMARK_DIR" ]; then
+    echo "Google Benchmark directory already exists. Skipping clone."
+else
+    echo "Cloning Google Benchmark..."
+    git clone https://github.com/google/benchmark.git "$BENCHMARK_DIR"
+    echo "Google Benchmark cloned successfully!"
+fi
+
+echo
+echo "V. Installing Doxygen (for documentation generation)..."
 if command -v apt-get &> /dev/null; then
     sudo apt-get install -y doxygen graphviz
     echo "Doxygen and Graphviz installed successfully!"
@@ -0,0 +1,56 @@
+/*
+    Author: Hanna Biegacz
+
+    Entry point of mower_batch - headless simulator. Runs every scenario given as an argument
+    as fast as possible and prints final coverage, simulated time, path length and wall time.
+    Scenarios are run in parallel on the given number of threads (by default one per processor core).
+
+    Usage: mower_batch [-j <threads>] <scenario_file> [<scenario_file> ...]
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BatchRunner.h"
+#include "Exceptions.h"
+#include "Scenario.h"
+
+using namespace std;
+
+
+int main(int argc, char *argv[]) {
+    int first_file = 1;
+    unsigned int threads_number = 0;
+
+    if (argc > 2 && string(argv[1]) == "-j") {
+        try {
+            threads_number = static_cast<unsigned int>(stoul(argv[2]));
+        } catch (const exception& e) {
+            cerr << "[Batch] Invalid threads number: " << argv[2] << endl;
+            return 1;
+        }
+        first_file = 3;
+    }
+    if (argc <= first_file) {
+        cerr << "Usage: " << argv[0] << " [-j <threads>] <scenario_file> [<scenario_file> ...]" << endl;
+        return 1;
+    }
+
+    int result = 0;
+    vector<Scenario> scenarios;
+
+    for (int i = first_file; i < argc; ++i) {
+        try {
+            scenarios.push_back(ScenarioParser::parseFile(argv[i]));
+        } catch (const ScenarioParseError& e) {
+            cerr << "[Batch] " << e.what() << endl;
+            result = 1;
+        }
+    }
+
+    for (const ScenarioResult& scenario_result : BatchRunner::runScenarios(scenarios, threads_number)) {
+        cout << BatchRunner::formatResult(scenario_result);
+    }
+
+    return result;
+}
@@ -0,0 +1,196 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of BatchRunner class.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include "BatchRunner.h"
+#include "Constants.h"
+#include "Exceptions.h"
+#include "FileLogger.h"
+#include "Lawn.h"
+#include "Logger.h"
+#include "Mower.h"
+#include "MowerController.h"
+#include "StateSimulation.h"
+
+using namespace std;
+
+namespace {
+    constexpr double SECONDS_TO_MILISECONDS_MULTIPLIER = 1000.0;
+
+    // Indexes of scenarios assigned to one worker. The owner takes them from the front,
+    // other workers steal from the back when their own queues are empty.
+    class WorkerQueue {
+    private:
+        mutex mutex_;
+        deque<size_t> indexes_;
+
+    public:
+        void push(const size_t& index) {
+            lock_guard<mutex> lock(mutex_);
+            indexes_.push_back(index);
+        }
+
+        bool popFront(size_t& index) {
+            lock_guard<mutex> lock(mutex_);
+            if (indexes_.empty()) {
+                return false;
+            }
+            index = indexes_.front();
+            indexes_.pop_front();
+            return true;
+        }
+
+        bool stealBack(size_t& index) {
+            lock_guard<mutex> lock(mutex_);
+            if (indexes_.empty()) {
+                return false;
+            }
+            index = indexes_.back();
+            indexes_.pop_back();
+            return true;
+        }
+    };
+
+    uint64_t countErrorLogs(Logger& logger) {
+        // Drains collected logs and counts the ones, which represent errors
+
+        uint64_t errors_number = 0;
+        logger.drain([&errors_number](Log&& log) {
+            if (log.isError()) {
+                ++errors_number;
+            }
+        });
+        return errors_number;
+    }
+
+    bool stealWork(vector<WorkerQueue>& queues, const size_t& worker_id, size_t& index) {
+        for (size_t i = 1; i < queues.size(); ++i) {
+            if (queues[(worker_id + i) % queues.size()].stealBack(index)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+// Builds the simulation described by the scenario and steps it until all commands are executed,
+// the time limit is reached or the mower tries to leave the lawn. Logs collected by the Logger
+// are dropped every step, as nobody displays them in headless mode - only errors among them are counted.
+ScenarioResult BatchRunner::runScenario(const Scenario& scenario) {
+    using Clock = chrono::steady_clock;
+    auto start_time = Clock::now();
+
+    ScenarioResult result;
+    result.name_ = scenario.name_;
+
+    Lawn lawn(scenario.lawn_width_, scenario.lawn_length_);
+    Mower mower(scenario.mower_width_, scenario.mower_length_, scenario.blade_diameter_, scenario.mower_speed_,
+        scenario.starting_x_, scenario.starting_y_, scenario.starting_angle_);
+    Logger logger;
+    FileLogger file_logger(scenario.log_path_, FlushPolicy(), scenario.log_format_);
+    StateSimulation simulation(lawn, mower, logger, file_logger);
+    simulation.setLogFilter(scenario.log_filter_);
+    MowerController controller;
+    scenario.addCommandsTo(controller);
+
+    u_int64_t max_simulation_time = static_cast<u_int64_t>(
+        ceil(scenario.max_simulation_time_ * SECONDS_TO_MILISECONDS_MULTIPLIER));
+    double previous_x = mower.getX();
+    double previous_y = mower.getY();
+
+    try {
+        while (controller.hasPendingCommands() && simulation.getTime() < max_simulation_time) {
+            controller.updateUntil(simulation, Constants::SIMULATION_TIMESTEP, max_simulation_time);
+            result.errors_number_ += countErrorLogs(logger);
+
+            result.path_length_ += hypot(mower.getX() - previous_x, mower.getY() - previous_y);
+            previous_x = mower.getX();
+            previous_y = mower.getY();
+            ++result.steps_number_;
+        }
+        result.is_finished_ = !controller.hasPendingCommands();
+    } catch (const MoveOutsideLawnError& e) {
+        result.error_ = e.what();
+        // the error is logged before the exception is thrown
+        result.errors_number_ += countErrorLogs(logger);
+        // steps made inside the lawn before the error are moved at once
+        result.path_length_ += hypot(mower.getX() - previous_x, mower.getY() - previous_y);
+    }
+
+    result.coverage_ = lawn.calculateShavedArea();
+    result.simulation_time_ = simulation.getTime();
+    result.wall_time_ = chrono::duration<double, milli>(Clock::now() - start_time).count();
+
+    return result;
+}
+
+
+// Runs scenarios on the given number of threads (0 means one thread per processor core).
+// Every worker gets a contiguous part of the scenarios, so neighbouring (usually similar) scenarios
+// run on one thread. Results are returned in the same order as scenarios.
+vector<ScenarioResult> BatchRunner::runScenarios(const vector<Scenario>& scenarios, 
+        const unsigned int& threads_number) {
+    vector<ScenarioResult> results(scenarios.size());
+    if (scenarios.empty()) {
+        return results;
+    }
+
+    size_t workers_number = threads_number > 0 ? threads_number : max(1u, thread::hardware_concurrency());
+    workers_number = min(workers_number, scenarios.size());
+
+    vector<WorkerQueue> queues(workers_number);
+    for (size_t i = 0; i < scenarios.size(); ++i) {
+        queues[i * workers_number / scenarios.size()].push(i);
+    }
+
+    auto work = [&scenarios, &results, &queues](const size_t& worker_id) {
+        size_t index = 0;
+        while (queues[worker_id].popFront(index) || stealWork(queues, worker_id, index)) {
+            try {
+                results[index] = runScenario(scenarios[index]);
+            } catch (const exception& e) {
+                results[index].name_ = scenarios[index].name_;
+                results[index].error_ = e.what();
+            }
+        }
+    };
+
+    vector<thread> workers;
+    for (size_t worker_id = 1; worker_id < workers_number; ++worker_id) {
+        workers.emplace_back(work, worker_id);
+    }
+    work(0);
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    return results;
+}
+
+
+string BatchRunner::formatResult(const ScenarioResult& result) {
+    ostringstream output;
+    output << fixed << setprecision(2);
+
+    output << "Scenario: " << result.name_ << "\n";
+    output << "  Coverage: " << result.coverage_ * 100.0 << " %\n";
+    output << "  Simulated time: " << result.simulation_time_ / SECONDS_TO_MILISECONDS_MULTIPLIER << " s\n";
+    output << "  Path length: " << result.path_length_ << " cm\n";
+    output << "  Wall time: " << result.wall_time_ << " ms\n";
+    output << "  Steps: " << result.steps_number_ << "\n";
+    output << "  Errors: " << result.errors_number_ << "\n";
+    output << "  Status: " << (result.error_.empty() ? (result.is_finished_ ? "finished" : "time limit reached") :
+        "stopped (" + result.error_ + ")") << "\n";
+
+    return output.str();
+}
@@ -3,20 +3,32 @@
     Implementation of the simulation Engine
 */
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <thread>
+#include "Constants.h"
 #include "Engine.h"
 #include "StateSimulation.h"
 #include "Exceptions.h"
+#include "Tracer.h"
 
 using namespace std::chrono;
 
 namespace {
-    constexpr double FIXED_TIMESTEP_SECONDS = 0.02;
     constexpr int TARGET_VISUALIZATION_FPS = 60;
     constexpr double MAX_FRAME_TIME_SECONDS = 0.25;
     constexpr int CPU_YIELD_SLEEP_MS = 1;
+    constexpr unsigned int DEFAULT_SNAPSHOT_DECIMATION = 1;
+    constexpr double SECONDS_TO_MILLISECONDS = 1e3;
+    constexpr double SECONDS_TO_MICROSECONDS = 1e6;
+    constexpr u_int64_t NO_END_TIME = std::numeric_limits<u_int64_t>::max();
+
+    uint64_t measureNanoseconds(const steady_clock::time_point& start_time) {
+        return static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start_time).count());
+    }
 }
 
 Engine::Engine(StateSimulation& simulation, 
@@ -25,9 +37,22 @@ Engine::Engine(StateSimulation& simulation,
     : simulation_(simulation)
     , running_(false)
     , speed_multiplier_(1.0)
-    , fixed_timestep_(FIXED_TIMESTEP_SECONDS)
+    , free_running_(false)
+    , snapshot_decimation_(DEFAULT_SNAPSHOT_DECIMATION)
+    , event_driven_(false)
+    , fixed_timestep_(Constants::SIMULATION_TIMESTEP)
     , user_simulation_callback_(user_logic ? user_logic : defaultSimulationLogic)
     , error_callback_(error_callback)
+    , tick_duration_(metrics_.addHistogram("tick_duration_ns"))
+    , steps_per_wakeup_(metrics_.addHistogram("steps_per_wakeup"))
+    , accumulator_backlog_(metrics_.addHistogram("accumulator_backlog_us"))
+    , snapshot_build_time_(metrics_.addHistogram("snapshot_build_ns"))
+    , state_lock_wait_(metrics_.addHistogram("state_lock_wait_ns"))
+    , cut_fields_per_tick_(metrics_.addHistogram("cut_fields_per_tick"))
+    , ticks_number_(metrics_.addCounter("ticks"))
+    , clamped_frames_number_(metrics_.addCounter("clamped_frames"))
+    , log_bytes_written_(metrics_.addCounter("log_bytes_written"))
+    , metrics_dump_interval_(steady_clock::duration::zero())
 {
     state_interpolator_.setStaticSimulationData(simulation_.getStaticData());
 }
@@ -54,6 +79,8 @@ void Engine::stop() {
 
     if (simulation_thread_.joinable()) {
         simulation_thread_.join();
+        state_interpolator_.flushSimulationSnapshots();
+        dumpMetrics(steady_clock::now());
     }
 }
 
@@ -72,6 +99,28 @@ double Engine::getSpeedMultiplier() const {
     return speed_multiplier_.load();
 }
 
+// In free running mode the simulation is not paced to the real time - fixed steps are executed
+// back to back, without sleeping and without limiting the frame time. Can be switched while running.
+void Engine::setFreeRunning(bool enabled) {
+    free_running_ = enabled;
+}
+
+bool Engine::isFreeRunning() const {
+    return free_running_.load();
+}
+
+// Sets how many fixed steps are executed per one snapshot published for the visualization
+// in free running mode. Building a snapshot every step would cost more than the step itself.
+void Engine::setSnapshotDecimation(unsigned int steps) {
+    if (steps > 0) {
+        snapshot_decimation_ = steps;
+    }
+}
+
+unsigned int Engine::getSnapshotDecimation() const {
+    return snapshot_decimation_.load();
+}
+
 // Allows you to replace the default simulation behavior with custom logic.
 // The callback function will be called every simulation step.
 void Engine::setUserSimulationLogic(std::function<void(StateSimulation&, double)> callback) {
@@ -84,6 +133,19 @@ void Engine::setOnErrorCallback(std::function<void(const std::string&)> callback
     error_callback_ = callback;
 }
 
+// Replaces stepping of the user logic with the event-driven logic, which advances the simulation
+// to its next event, but not past the given end time (ms), and returns the time reached,
+// e.g. MowerController::updateUntil. Null callback switches back to the stepped user logic.
+void Engine::setEventDrivenSimulationLogic(std::function<u_int64_t(StateSimulation&, double, u_int64_t)> callback) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    event_driven_callback_ = callback;
+    event_driven_ = static_cast<bool>(event_driven_callback_);
+}
+
+bool Engine::isEventDriven() const {
+    return event_driven_.load();
+}
+
 void Engine::defaultSimulationLogic(StateSimulation& simulation, double dt) {
     // by default the mower is doing nothing
 }
@@ -96,71 +158,217 @@ StateInterpolator& Engine::getStateInterpolator() {
     return state_interpolator_;
 }
 
+const MetricsRegistry& Engine::getMetrics() const {
+    return metrics_;
+}
+
+// Metrics are saved to the file every interval (of real time) while the simulation runs and once more
+// when it stops. Takes effect on the next start().
+void Engine::setMetricsDump(const std::string& path, double interval_seconds) {
+    metrics_dump_path_ = path;
+    metrics_dump_interval_ = duration_cast<steady_clock::duration>(duration<double>(std::max(interval_seconds, 0.0)));
+}
+
 // Main simulation loop running in a separate thread. Uses "fixed timestep" which means
 // the simulation always advances by exactly 0.02 seconds per step, regardless of how
 // fast or slow the computer is. This keeps physics consistent and predictable.
 // The "accumulator" collects real time that has passed and converts it into fixed steps.
+// In free running mode the real time is ignored and steps are executed as fast as possible.
 void Engine::runSimulation() {
+    TRACE_THREAD_NAME("simulation");
     using Clock = std::chrono::steady_clock;
     auto previous_time = Clock::now();
     double accumulator = 0.0;
+    last_metrics_dump_time_ = previous_time;
 
     while (running_) {
         auto current_time = Clock::now();
         duration<double> frame_time = current_time - previous_time;
         previous_time = current_time;
 
+        if (!metrics_dump_path_.empty() && current_time - last_metrics_dump_time_ >= metrics_dump_interval_) {
+            dumpMetrics(current_time);
+        }
+        // The last snapshot may wait for space in the channel, when no new one is published (e.g. idle mower)
+        state_interpolator_.flushSimulationSnapshots();
+
+        if (free_running_) {
+            accumulator = 0.0;
+            runFreeSteps();
+            continue;
+        }
+
         if (frame_time.count() > MAX_FRAME_TIME_SECONDS) {
             frame_time = duration<double>(MAX_FRAME_TIME_SECONDS);
+            clamped_frames_number_.add();
         }
 
         accumulator += frame_time.count() * speed_multiplier_.load();
+        runRealTimeSteps(accumulator);
 
-        while (accumulator >= fixed_timestep_) {
-            try {
-                updateSimulation(fixed_timestep_);
-            } catch (const MoveOutsideLawnError& e) {
-                std::cerr << "[Engine] Simulation stopped: " << e.what() << std::endl;
-                running_ = false;
-                if (error_callback_) {
-                    error_callback_(e.what());
-                }
-                break;
-            }
-            accumulator -= fixed_timestep_;
+        std::this_thread::sleep_for(std::chrono::milliseconds(CPU_YIELD_SLEEP_MS));
+    }
+}
+
+// Executes as many fixed steps as the accumulated real time allows.
+// Event-driven logic jumps from event to event through all of them instead (one update per event).
+void Engine::runRealTimeSteps(double& accumulator) {
+    accumulator_backlog_.record(static_cast<uint64_t>(accumulator * SECONDS_TO_MICROSECONDS));
+
+    if (event_driven_) {
+        runRealTimeEvents(accumulator);
+        return;
+    }
+
+    uint64_t steps = 0;
+    while (accumulator >= fixed_timestep_) {
+        if (!tryUpdateSimulation(fixed_timestep_, true)) {
+            break;
         }
+        accumulator -= fixed_timestep_;
+        ++steps;
+    }
+    steps_per_wakeup_.record(steps);
+}
 
-        std::this_thread::sleep_for(std::chrono::milliseconds(CPU_YIELD_SLEEP_MS));
+// Advances the simulation by the due fixed steps. Every update of the event-driven logic stops at an event
+// (e.g. the end of a move), where a snapshot is published, so the visualization interpolates along straight
+// segments. Stops early when the logic is idle - no command moves the simulation time.
+void Engine::runRealTimeEvents(double& accumulator) {
+    uint64_t due_steps = static_cast<uint64_t>(std::floor(accumulator / fixed_timestep_));
+    if (due_steps == 0) {
+        steps_per_wakeup_.record(0);
+        return;
+    }
+
+    u_int64_t reached_time = simulation_.getTime();
+    const u_int64_t end_time = reached_time + static_cast<u_int64_t>(
+        std::llround(static_cast<double>(due_steps) * fixed_timestep_ * SECONDS_TO_MILLISECONDS));
+    do {
+        u_int64_t previous_time = reached_time;
+        if (!tryUpdateSimulation(fixed_timestep_, true, end_time, &reached_time)) {
+            steps_per_wakeup_.record(0);
+            return;
+        }
+        if (reached_time == previous_time) {
+            break;
+        }
+    } while (reached_time < end_time && running_);
+
+    accumulator -= static_cast<double>(due_steps) * fixed_timestep_;
+    steps_per_wakeup_.record(due_steps);
+}
+
+// Executes one batch of fixed steps back to back. Only the last step of the batch
+// publishes a snapshot, so the visualization still gets regular updates.
+// Event-driven logic is not limited by the end time - one update jumps straight to the next event,
+// so a long move costs one update, whatever the snapshot decimation is.
+void Engine::runFreeSteps() {
+    const unsigned int steps = snapshot_decimation_.load();
+
+    if (event_driven_) {
+        u_int64_t start_time = simulation_.getTime();
+        u_int64_t reached_time = start_time;
+        if (!tryUpdateSimulation(fixed_timestep_, true, NO_END_TIME, &reached_time)) {
+            steps_per_wakeup_.record(0);
+            return;
+        }
+        const double step_duration = fixed_timestep_ * SECONDS_TO_MILLISECONDS;
+        steps_per_wakeup_.record(static_cast<uint64_t>(std::llround((reached_time - start_time) / step_duration)));
+        if (reached_time == start_time) {
+            // nothing to do until the user logic gets new commands
+            std::this_thread::sleep_for(std::chrono::milliseconds(CPU_YIELD_SLEEP_MS));
+        }
+        return;
+    }
+
+    uint64_t executed_steps = 0;
+    for (unsigned int step = 1; step <= steps && running_; ++step) {
+        if (!tryUpdateSimulation(fixed_timestep_, step == steps)) {
+            break;
+        }
+        ++executed_steps;
+    }
+    steps_per_wakeup_.record(executed_steps);
+}
+
+// Runs one step and stops the simulation if the mower tried to leave the lawn.
+// Returns false when the simulation was stopped. Simulation time after the step is saved in reached_time.
+bool Engine::tryUpdateSimulation(double dt, bool publish_snapshot, u_int64_t end_time, u_int64_t* reached_time) {
+    try {
+        u_int64_t time = updateSimulation(dt, publish_snapshot, end_time);
+        if (reached_time) {
+            *reached_time = time;
+        }
+    } catch (const MoveOutsideLawnError& e) {
+        std::cerr << "[Engine] Simulation stopped: " << e.what() << std::endl;
+        running_ = false;
+        if (error_callback_) {
+            error_callback_(e.what());
+        }
+        return false;
     }
+    return true;
 }
 
 // Executes one simulation step: runs user logic, saves logs, and creates
-// a snapshot for smooth rendering. Thread-safe with mutex lock.
-void Engine::updateSimulation(double dt) {
+// a snapshot for smooth rendering (if requested). Thread-safe with mutex lock.
+// Event-driven logic is run instead of one step - it jumps to the next event, but not past the end time.
+// Returns the simulation time after the step.
+u_int64_t Engine::updateSimulation(double dt, bool publish_snapshot, u_int64_t end_time) {
+    TRACE_SCOPE("Engine::updateSimulation");
+    auto tick_start_time = steady_clock::now();
+    uint64_t cut_fields_number = simulation_.getLawn().getGrid().countSetFields();
+    u_int64_t reached_time = 0;
     {
         std::lock_guard<std::mutex> lock(state_mutex_);
-        if (user_simulation_callback_) {
-            user_simulation_callback_(simulation_, dt);
+        state_lock_wait_.record(measureNanoseconds(tick_start_time));
+        if (event_driven_callback_) {
+            reached_time = event_driven_callback_(simulation_, dt, end_time);
+        } else {
+            if (user_simulation_callback_) {
+                user_simulation_callback_(simulation_, dt);
+            }
+            reached_time = simulation_.getTime();
         }
         processLogs();
     }
-    state_interpolator_.addSimulationSnapshot(simulation_.buildSimulationSnapshot());
-    state_interpolator_.setSimulationSpeedMultiplier(speed_multiplier_.load());
+    uint64_t new_cut_fields_number = simulation_.getLawn().getGrid().countSetFields();
+    cut_fields_per_tick_.record(new_cut_fields_number > cut_fields_number ? new_cut_fields_number - cut_fields_number : 0);
+    log_bytes_written_.set(simulation_.getFileLogger().getWrittenBytes());
+    ticks_number_.add();
+
+    if (publish_snapshot) {
+        auto build_start_time = steady_clock::now();
+        SimulationSnapshot snapshot = simulation_.buildSimulationSnapshot();
+        snapshot_build_time_.record(measureNanoseconds(build_start_time));
+
+        state_interpolator_.addSimulationSnapshot(std::move(snapshot));
+        state_interpolator_.setSimulationSpeedMultiplier(speed_multiplier_.load());
+    }
+    tick_duration_.record(measureNanoseconds(tick_start_time));
+    return reached_time;
 }
 
 void Engine::processLogs() {
-    Logger& logger = simulation_.getLogger();
-    std::queue<Log> logsQueue = logger.getLogs();
-    if (logsQueue.empty()) {
+    const FileLogger& fileLogger = simulation_.getFileLogger();
+
+    simulation_.getLogger().drain([&fileLogger](Log&& log) {
+        if (log.isError()) {
+            fileLogger.saveError(std::move(log));
+        }
+        else {
+            fileLogger.saveLog(std::move(log));
+        }
+    });
+}
+
+void Engine::dumpMetrics(const steady_clock::time_point& current_time) {
+    last_metrics_dump_time_ = current_time;
+    if (metrics_dump_path_.empty()) {
         return;
     }
-
-    const FileLogger& fileLogger = simulation_.getFileLogger();
-    
-    while (!logsQueue.empty()) {
-        fileLogger.saveLog(logsQueue.front());
-        logsQueue.pop();
+    if (!metrics_.saveMetrics(metrics_dump_path_)) {
+        std::cerr << "[Engine] Unable to save metrics to " << metrics_dump_path_ << std::endl;
     }
-
-    logger.clear();
 }
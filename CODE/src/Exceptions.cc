@@ -27,3 +27,21 @@ const char* RotationAngleOutOfRangeError::what() const noexcept {
     return msg.c_str();
 }
 
+
+
+ScenarioParseError::ScenarioParseError(const string& message)
+    : msg(message) {}
+
+
+const char* ScenarioParseError::what() const noexcept {
+    return msg.c_str();
+}
+
+
+CorruptLogRecordError::CorruptLogRecordError(const string& message)
+    : msg(message) {}
+
+
+const char* CorruptLogRecordError::what() const noexcept {
+    return msg.c_str();
+}
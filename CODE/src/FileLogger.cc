@@ -5,17 +5,322 @@
 */
 
 
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <thread>
 #include "FileLogger.h"
+#include "LogRingBuffer.h"
 
 
 using namespace std;
 
 
-FileLogger::FileLogger(const string& file_path) : file_path_(file_path) {}
+namespace {
+    constexpr size_t BUFFER_CAPACITY = 4096;
+    constexpr unsigned int MAX_IDLE_WAIT_MS = 1000;
 
+    string calculateCanonicalPath(const string& path) {
+        // Paths of one file written in different ways (e.g. relative and absolute) give the same result
+
+        error_code error;
+        filesystem::path canonical_path = filesystem::weakly_canonical(path, error);
+        return error ? path : canonical_path.string();
+    }
+}
+
+
+// Background writer shared by all FileLoggers of one file, so the file is written only by its thread.
+// The thread is started with the first log.
+class FileLogWriter {
+private:
+    // Writers of open files by canonical path. Entries of destroyed writers are removed by their destructors
+    static mutex writers_mutex_;
+    static map<string, weak_ptr<FileLogWriter>> writers_;
+
+    string file_path_;
+    string canonical_path_;
+    FlushPolicy flush_policy_;
+    LogFileFormat format_;
+    LogRingBuffer buffer_;
+    ofstream file_;
+    string batch_;
+    bool has_unflushed_data_ = false;
+
+    thread thread_;
+    once_flag start_flag_;
+    atomic<bool> is_started_{false};
+    atomic<bool> is_stopping_{false};
+    atomic<bool> is_waiting_{false};
+    mutex wait_mutex_;
+    condition_variable wake_condition_;
+    condition_variable flushed_condition_;
+    size_t flush_target_ = 0; // guarded by wait_mutex_
+    size_t flushed_number_ = 0; // guarded by wait_mutex_
+    atomic<uint64_t> written_bytes_{0};
+
+    void start();
+    void wakeUp();
+    void run();
+    size_t writeAvailableEntries(bool& has_error);
+    void waitForEntries(const bool& is_flush_pending);
+    void appendEntry(const LogEntry& entry);
+    void openFile();
+
+public:
+    FileLogWriter(const string& file_path, const FlushPolicy& flush_policy, const LogFileFormat& format);
+    FileLogWriter(const FileLogWriter&) = delete;
+    FileLogWriter& operator=(const FileLogWriter&) = delete;
+    ~FileLogWriter();
+
+    static shared_ptr<FileLogWriter> getWriter(const string& file_path, const FlushPolicy& flush_policy, 
+        const LogFileFormat& format);
+    void push(LogEntry& entry);
+    void flush();
+    uint64_t getWrittenBytes() const;
+};
+
+
+mutex FileLogWriter::writers_mutex_;
+map<string, weak_ptr<FileLogWriter>> FileLogWriter::writers_;
+
+
+FileLogWriter::FileLogWriter(const string& file_path, const FlushPolicy& flush_policy, const LogFileFormat& format) 
+    : file_path_(file_path), canonical_path_(calculateCanonicalPath(file_path)), flush_policy_(flush_policy), 
+    format_(format), buffer_(BUFFER_CAPACITY) {}
+
+
+FileLogWriter::~FileLogWriter() {
+    // Stop the writer thread. It saves and flushes all remaining logs before finishing
+
+    if (is_started_.load()) {
+        is_stopping_.store(true);
+        wakeUp();
+        thread_.join();
+    }
+
+    lock_guard<mutex> lock(writers_mutex_);
+    auto writer = writers_.find(canonical_path_);
+    if (writer != writers_.end() && writer->second.expired()) {
+        writers_.erase(writer);
+    }
+}
+
+
+shared_ptr<FileLogWriter> FileLogWriter::getWriter(const string& file_path, const FlushPolicy& flush_policy, 
+        const LogFileFormat& format) {
+    /* Return the writer of the file, creating it when the file has no writer yet. Simulations running in parallel 
+        may log to the same file - with one writer its records are never interleaved and the binary header is 
+        written once. Flush policy and format of the logger, which created the writer, are used. 
+        When the previous writer of the file is being destroyed, waits until it saves its remaining logs */
+
+    if (file_path.empty()) {
+        return nullptr;
+    }
+
+    const string canonical_path = calculateCanonicalPath(file_path);
+    while (true) {
+        {
+            lock_guard<mutex> lock(writers_mutex_);
+            auto registered_writer = writers_.find(canonical_path);
+            if (registered_writer == writers_.end()) {
+                shared_ptr<FileLogWriter> writer = make_shared<FileLogWriter>(file_path, flush_policy, format);
+                writers_[canonical_path] = writer;
+                return writer;
+            }
+            if (shared_ptr<FileLogWriter> writer = registered_writer->second.lock()) {
+                return writer;
+            }
+        }
+        this_thread::yield();
+    }
+}
+
+
+void FileLogWriter::push(LogEntry& entry) {
+    // Put entry into the buffer. When the buffer is full, wait for the writer to make space
+
+    start();
+    while (!buffer_.tryPush(entry)) {
+        wakeUp();
+        this_thread::yield();
+    }
+    if (is_waiting_.load()) {
+        wakeUp();
+    }
+}
+
+
+void FileLogWriter::flush() {
+    // Block until all logs pushed before the call are written and flushed to the file
+
+    start();
+    size_t target = buffer_.getPushedNumber();
+    unique_lock<mutex> lock(wait_mutex_);
+    flush_target_ = max(flush_target_, target);
+    wake_condition_.notify_one();
+    flushed_condition_.wait(lock, [this, target]() { return flushed_number_ >= target; });
+}
+
+
+uint64_t FileLogWriter::getWrittenBytes() const {
+    return written_bytes_.load(memory_order_relaxed);
+}
+
+
+void FileLogWriter::start() {
+    call_once(start_flag_, [this]() {
+        thread_ = thread(&FileLogWriter::run, this);
+        is_started_.store(true);
+    });
+}
+
+
+void FileLogWriter::wakeUp() {
+    lock_guard<mutex> lock(wait_mutex_);
+    wake_condition_.notify_one();
+}
 
-FileLogger::FileLogger(const FileLogger& other) : file_path_(other.getFilePath()) {}
+
+void FileLogWriter::run() {
+    /* Writer loop: saves all available logs as one batch, then flushes the file if the flush policy requires it
+        (interval passed, error logged, flush requested or logger destroyed) and sleeps until new logs arrive */
+
+    using Clock = chrono::steady_clock;
+    const chrono::milliseconds flush_interval(flush_policy_.flush_interval_ms_);
+    auto last_flush_time = Clock::now();
+
+    while (true) {
+        bool is_stopping = is_stopping_.load();
+        bool has_error = false;
+        size_t written_number = writeAvailableEntries(has_error);
+
+        size_t flush_target = 0;
+        {
+            lock_guard<mutex> lock(wait_mutex_);
+            flush_target = flush_target_;
+        }
+        size_t popped_number = buffer_.getPoppedNumber();
+        bool is_flush_requested = flush_target > flushed_number_;
+        bool is_interval_passed = flush_policy_.flush_interval_ms_ > 0 && 
+            Clock::now() - last_flush_time >= flush_interval;
+
+        if (is_stopping || is_flush_requested || (has_error && flush_policy_.flush_on_error_) || 
+                (is_interval_passed && has_unflushed_data_)) {
+            if (has_unflushed_data_ && file_.is_open()) {
+                file_.flush();
+            }
+            has_unflushed_data_ = false;
+            last_flush_time = Clock::now();
+            {
+                lock_guard<mutex> lock(wait_mutex_);
+                flushed_number_ = popped_number;
+            }
+            flushed_condition_.notify_all();
+        }
+
+        if (is_stopping && buffer_.getPoppedNumber() == buffer_.getPushedNumber()) {
+            break;
+        }
+        if (written_number == 0) {
+            waitForEntries(flush_target > popped_number);
+        }
+    }
+}
+
+
+size_t FileLogWriter::writeAvailableEntries(bool& has_error) {
+    // Save all logs available in the buffer to the file with one write. Returns number of saved logs
+
+    LogEntry entry;
+    size_t entries_number = 0;
+    batch_.clear();
+
+    while (buffer_.tryPop(entry)) {
+        appendEntry(entry);
+        has_error = has_error || entry.is_error_;
+        ++entries_number;
+    }
+    if (entries_number == 0) {
+        return 0;
+    }
+
+    if (!file_.is_open()) {
+        openFile();
+    }
+    if (file_.is_open()) {
+        file_.write(batch_.data(), static_cast<streamsize>(batch_.size()));
+        has_unflushed_data_ = true;
+        written_bytes_.fetch_add(batch_.size(), memory_order_relaxed);
+    }
+    return entries_number;
+}
+
+
+void FileLogWriter::waitForEntries(const bool& is_flush_pending) {
+    // Sleep until a producer wakes the writer up or it is time for the periodic flush
+
+    if (is_flush_pending) {
+        this_thread::yield();
+        return;
+    }
+    unsigned int wait_ms = flush_policy_.flush_interval_ms_ > 0 && has_unflushed_data_ ? 
+        flush_policy_.flush_interval_ms_ : MAX_IDLE_WAIT_MS;
+
+    unique_lock<mutex> lock(wait_mutex_);
+    is_waiting_.store(true);
+    if (buffer_.getPoppedNumber() == buffer_.getPushedNumber() && !is_stopping_.load() && 
+            flush_target_ <= flushed_number_) {
+        wake_condition_.wait_for(lock, chrono::milliseconds(wait_ms));
+    }
+    is_waiting_.store(false);
+}
+
+
+void FileLogWriter::openFile() {
+    // Open file for appending. New binary log file starts with the header
+
+    file_.clear();
+    file_.open(file_path_, ios::app | ios::ate | ios::binary);
+    if (file_.is_open() && format_ == LogFileFormat::BINARY && file_.tellp() == 0) {
+        file_.write(LogEvent::BINARY_LOG_HEADER, sizeof(LogEvent::BINARY_LOG_HEADER));
+    }
+}
+
+
+void FileLogWriter::appendEntry(const LogEntry& entry) {
+    // Append entry to the batch as a binary record or as a line of text
+
+    if (format_ == LogFileFormat::BINARY) {
+        if (entry.has_event_) {
+            entry.event_.appendRecord(batch_);
+        }
+        else {
+            LogEvent::appendTextRecord(batch_, entry.time_, entry.has_time_, entry.is_error_, entry.message_);
+        }
+        return;
+    }
+
+    if (entry.has_event_) {
+        batch_ += entry.event_.formatLine();
+    }
+    else {
+        batch_ += LogEvent::formatLine(entry.time_, entry.has_time_, entry.message_);
+    }
+    batch_ += '\n';
+}
+
+
+FileLogger::FileLogger(const string& file_path, const FlushPolicy& flush_policy, const LogFileFormat& format) 
+    : file_path_(file_path), flush_policy_(flush_policy), format_(format), 
+    writer_(FileLogWriter::getWriter(file_path, flush_policy, format)) {}
+
+
+FileLogger::FileLogger(const FileLogger& other) : file_path_(other.getFilePath()), 
+    flush_policy_(other.getFlushPolicy()), format_(other.getFormat()), writer_(other.writer_) {}
 
 
 const string& FileLogger::getFilePath() const {
@@ -23,24 +328,90 @@ const string& FileLogger::getFilePath() const {
 }
 
 
+const FlushPolicy& FileLogger::getFlushPolicy() const {
+    return flush_policy_;
+}
+
+
+const LogFileFormat& FileLogger::getFormat() const {
+    return format_;
+}
+
+
+uint64_t FileLogger::getWrittenBytes() const {
+    // Number of bytes of logs written to the file so far (without the binary log header)
+
+    return writer_ ? writer_->getWrittenBytes() : 0;
+}
+
+
 void FileLogger::saveLog(const Log& log) const {
     // Save log to the logs file
 
-    ofstream file(file_path_, ios::app);
-    if (file.is_open()) {
-        file << "Time: "<< log.getTime() << ": " << log.getMessage() << endl;
+    if (writer_) {
+        LogEntry entry{log.getTime(), log.getMessage(), true, false};
+        writer_->push(entry);
+    }
+}
+
+
+void FileLogger::saveLog(Log&& log) const {
+    // Save log, moving its message to the writer instead of copying it
+
+    if (writer_) {
+        LogEntry entry{log.getTime(), log.releaseMessage(), true, false};
+        writer_->push(entry);
+    }
+}
+
+
+void FileLogger::saveError(const Log& log) const {
+    // Save log describing an error to the logs file. Depending on flush policy, it is flushed immediately
+
+    if (writer_) {
+        LogEntry entry{log.getTime(), log.getMessage(), true, true};
+        writer_->push(entry);
+    }
+}
+
+
+void FileLogger::saveError(Log&& log) const {
+    // Save log describing an error, moving its message to the writer instead of copying it
+
+    if (writer_) {
+        LogEntry entry{log.getTime(), log.releaseMessage(), true, true};
+        writer_->push(entry);
     }
-    file.close();
 }
 
 
 void FileLogger::saveMessage(const string& message) const {
     // Save message to the logs file
 
-    ofstream file(file_path_, ios::app);
+    if (writer_) {
+        LogEntry entry{0, message, false, false};
+        writer_->push(entry);
+    }
+}
+
+
+void FileLogger::saveEvent(const LogEvent& event) const {
+    // Save structured event. It is formatted (or saved as binary record) by the writer thread
+
+    if (writer_) {
+        LogEntry entry;
+        entry.is_error_ = event.isError();
+        entry.has_event_ = true;
+        entry.event_ = event;
+        writer_->push(entry);
+    }
+}
+
+
+void FileLogger::flush() const {
+    // Wait until all saved logs are in the file
 
-    if (file.is_open()) {
-        file << message << endl;
+    if (writer_) {
+        writer_->flush();
     }
-    file.close();
 }
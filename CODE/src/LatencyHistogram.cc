@@ -0,0 +1,98 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of LatencyHistogram.
+*/
+
+#include "LatencyHistogram.h"
+
+using namespace std;
+
+
+LatencyHistogram::LatencyHistogram() {
+    reset();
+}
+
+
+void LatencyHistogram::record(const uint64_t& nanoseconds) {
+    buckets_[calculateBucket(nanoseconds)].fetch_add(1, memory_order_relaxed);
+    count_.fetch_add(1, memory_order_relaxed);
+    total_.fetch_add(nanoseconds, memory_order_relaxed);
+
+    uint64_t current_max = max_.load(memory_order_relaxed);
+    while (nanoseconds > current_max && !max_.compare_exchange_weak(current_max, nanoseconds, memory_order_relaxed)) {
+    }
+}
+
+
+void LatencyHistogram::reset() {
+    for (atomic<uint64_t>& bucket : buckets_) {
+        bucket.store(0, memory_order_relaxed);
+    }
+    count_.store(0, memory_order_relaxed);
+    total_.store(0, memory_order_relaxed);
+    max_.store(0, memory_order_relaxed);
+}
+
+
+uint64_t LatencyHistogram::getCount() const {
+    return count_.load(memory_order_relaxed);
+}
+
+
+uint64_t LatencyHistogram::getMax() const {
+    return max_.load(memory_order_relaxed);
+}
+
+
+double LatencyHistogram::getMean() const {
+    uint64_t count = getCount();
+    if (count == 0) {
+        return 0.0;
+    }
+    return static_cast<double>(total_.load(memory_order_relaxed)) / static_cast<double>(count);
+}
+
+
+uint64_t LatencyHistogram::getBucketCount(const size_t& bucket) const {
+    return buckets_[bucket].load(memory_order_relaxed);
+}
+
+
+// Returns upper bound of the bucket containing the given percentile (0 - 100) of recorded latencies.
+uint64_t LatencyHistogram::getPercentile(const double& percentile) const {
+    uint64_t count = getCount();
+    if (count == 0) {
+        return 0;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(percentile / 100.0 * static_cast<double>(count));
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < BUCKETS_NUMBER; ++bucket) {
+        seen += getBucketCount(bucket);
+        if (seen >= rank) {
+            return getBucketUpperBound(bucket);
+        }
+    }
+    return getMax();
+}
+
+
+size_t LatencyHistogram::calculateBucket(const uint64_t& nanoseconds) {
+    size_t bucket = 0;
+    uint64_t value = nanoseconds;
+    while (value != 0 && bucket < BUCKETS_NUMBER - 1) {
+        value >>= 1;
+        ++bucket;
+    }
+    return bucket;
+}
+
+
+uint64_t LatencyHistogram::getBucketUpperBound(const size_t& bucket) {
+    return (uint64_t(1) << bucket) - 1;
+}
@@ -4,26 +4,28 @@
     Describes Lawn, on which mower is cutting grass.
 */
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include "Lawn.h"
-#include "MathHelper.h"
 #include "Config.h"
+#include "Tracer.h"
 
 using namespace std;
 
 
 Lawn::Lawn(const unsigned int& lawn_width, const unsigned int& lawn_length)
-    : width_(lawn_width), length_(lawn_length)
+    : width_(lawn_width), length_(lawn_length), generation_(0), oldest_tracked_generation_(0)
     {
-        Config::initializeRuntimeConstants(width_, length_);
-        fields_.resize(Config::VERTICAL_FIELDS_NUMBER, std::vector<bool>(Config::HORIZONTAL_FIELDS_NUMBER, false));
+        Config config(width_, length_);
+        field_width_ = config.getFieldWidth();
+        grid_ = LawnGrid(config.getHorizontalFieldsNumber(), config.getVerticalFieldsNumber());
     }
 
 
 bool Lawn::operator==(const Lawn& other) const {
     return this->width_ == other.getWidth() && this->length_ == other.getLength() && 
-        this->fields_ == other.getFields();
+        this->grid_ == other.getGrid();
 }
 
 
@@ -42,8 +44,94 @@ unsigned int Lawn::getLength() const {
 }
 
 
+double Lawn::getFieldWidth() const {
+    return field_width_;
+}
+
+
 std::vector<std::vector<bool>> Lawn::getFields() const {
-    return fields_;
+    return grid_.toFields();
+}
+
+
+const LawnGrid& Lawn::getGrid() const {
+    return grid_;
+}
+
+
+uint64_t Lawn::getGeneration() const {
+    return generation_;
+}
+
+
+vector<LawnRegion> Lawn::takeDirtyRegionsSince(const uint64_t& generation) const {
+    /* Return regions, which contain all fields mowed after given generation. Regions may overlap and cover 
+        fields which did not change. If history of given generation is no longer stored, whole lawn is returned */
+
+    vector<LawnRegion> regions;
+
+    if (generation >= generation_ || grid_.isEmpty()) {
+        return regions;
+    }
+    if (generation < oldest_tracked_generation_) {
+        regions.push_back(getWholeLawnRegion());
+        return regions;
+    }
+
+    for (auto it = dirty_regions_.rbegin(); it != dirty_regions_.rend() && it->generation_ > generation; ++it) {
+        regions.push_back(it->region_);
+    }
+
+    return regions;
+}
+
+
+void Lawn::markRegionAsDirty(const pair<unsigned int, unsigned int>& first_indexes, 
+        const pair<unsigned int, unsigned int>& last_indexes, const uint64_t& mowed_fields_before) {
+    /* Record bounding box of the cut as the next generation of the lawn. Nothing is recorded if the cut did not 
+        mow any new field. Region overlapping the previous one is merged with it, if their bounding box is not 
+        bigger than both regions together, so mowing along a path keeps the history short */
+
+    if (grid_.countSetFields() == mowed_fields_before) {
+        return;
+    }
+
+    LawnRegion region;
+    region.first_column_ = min(first_indexes.first, grid_.getColumnsNumber() - 1);
+    region.first_row_ = min(first_indexes.second, grid_.getRowsNumber() - 1);
+    region.last_column_ = min(last_indexes.first, grid_.getColumnsNumber() - 1);
+    region.last_row_ = min(last_indexes.second, grid_.getRowsNumber() - 1);
+    ++generation_;
+
+    if (!dirty_regions_.empty()) {
+        LawnRegion& last_region = dirty_regions_.back().region_;
+        LawnRegion merged_region;
+        merged_region.first_column_ = min(last_region.first_column_, region.first_column_);
+        merged_region.first_row_ = min(last_region.first_row_, region.first_row_);
+        merged_region.last_column_ = max(last_region.last_column_, region.last_column_);
+        merged_region.last_row_ = max(last_region.last_row_, region.last_row_);
+
+        if (merged_region.countFields() <= last_region.countFields() + region.countFields()) {
+            last_region = merged_region;
+            dirty_regions_.back().generation_ = generation_;
+            return;
+        }
+    }
+
+    dirty_regions_.push_back(DirtyRegion{generation_, region});
+    if (dirty_regions_.size() > MAX_DIRTY_REGIONS_NUMBER) {
+        oldest_tracked_generation_ = dirty_regions_.front().generation_;
+        dirty_regions_.pop_front();
+    }
+}
+
+
+LawnRegion Lawn::getWholeLawnRegion() const {
+    LawnRegion region;
+    region.last_column_ = grid_.getColumnsNumber() - 1;
+    region.last_row_ = grid_.getRowsNumber() - 1;
+
+    return region;
 }
 
 
@@ -68,8 +156,8 @@ bool Lawn::countIfCoordInSection(const unsigned int& section_length,
 pair<unsigned int, unsigned int> Lawn::calculateFieldIndexes(const double& x, const double& y) const {
     // Calculate index of the field located inside the lawn
 
-    unsigned int x_index = Lawn::calculateIndexInSection(width_, x, fields_[0].size());
-    unsigned int y_index = Lawn::calculateIndexInSection(length_, y, fields_.size());
+    unsigned int x_index = Lawn::calculateIndexInSection(width_, x, grid_.getColumnsNumber());
+    unsigned int y_index = Lawn::calculateIndexInSection(length_, y, grid_.getRowsNumber());
 
     pair<unsigned int, unsigned int> field_indexes = pair<unsigned int, unsigned int>(x_index, y_index);
 
@@ -78,291 +166,435 @@ pair<unsigned int, unsigned int> Lawn::calculateFieldIndexes(const double& x, co
 
 
 unsigned int Lawn::calculateIndexInSection(const unsigned int& section_length, const double& coord_value, 
-        const unsigned int& vector_size) {
+        const unsigned int& vector_size) const {
     // Calculate index of the coord in section
 
-    unsigned int index = static_cast<unsigned int>(coord_value / Config::FIELD_WIDTH);
+    unsigned int index = static_cast<unsigned int>(coord_value / field_width_);
 
     return index;
 }
 
 
 void Lawn::cutGrassOnField(const pair<unsigned int, unsigned int>& indexes) {
-    // Change field state to mowed 
+    // Change field state to mowed. Indexes outside the lawn are ignored
 
-    fields_[indexes.second][indexes.first] = true;
+    uint64_t mowed_fields_before = grid_.countSetFields();
+    grid_.setField(indexes.first, indexes.second);
+    markRegionAsDirty(indexes, indexes, mowed_fields_before);
 }
 
 
 double Lawn::calculateShavedArea() const {
-    // Calculate shaved area of the field as ratio of mowed fields to not mowed fields
+    // Calculate shaved area of the field as ratio of mowed fields to all fields. Uses counter kept by the grid
 
-    int64_t all_fields_number = static_cast<int64_t>(Config::HORIZONTAL_FIELDS_NUMBER) * 
-        static_cast<int64_t>(Config::VERTICAL_FIELDS_NUMBER);
-    int64_t shaved_fields_number = 0;
+    int64_t all_fields_number = static_cast<int64_t>(grid_.getColumnsNumber()) * 
+        static_cast<int64_t>(grid_.getRowsNumber());
+    int64_t shaved_fields_number = static_cast<int64_t>(grid_.countSetFields());
 
-    for (const std::vector<bool>& shavedRow : getFields()) {
-        for (bool field : shavedRow) {
-            if (field) shaved_fields_number ++;
-        }
+    return static_cast<double>(shaved_fields_number) / static_cast<double>(all_fields_number);
+}
+
+
+double Lawn::calculateShavedArea(const pair<double, double>& left_down_corner, 
+        const pair<double, double>& right_up_corner) const {
+    /* Calculate shaved area of rectangular region of the lawn as ratio of mowed fields to all fields in region.
+        Region consists of all fields, which contain at least part of the rectangle */
+
+    double LEFT_DOWN_CORNER_COORD = 0.0;
+    double right_x = min(right_up_corner.first, static_cast<double>(width_));
+    double up_y = min(right_up_corner.second, static_cast<double>(length_));
+    pair<unsigned int, unsigned int> first_indexes = calculateFieldIndexes(
+        max(left_down_corner.first, LEFT_DOWN_CORNER_COORD), max(left_down_corner.second, LEFT_DOWN_CORNER_COORD));
+    pair<unsigned int, unsigned int> last_indexes = calculateFieldIndexes(right_x, up_y);
+    unsigned int last_column = min(last_indexes.first, grid_.getColumnsNumber() - 1);
+    unsigned int last_row = min(last_indexes.second, grid_.getRowsNumber() - 1);
+
+    if (right_x < left_down_corner.first || up_y < left_down_corner.second || 
+        first_indexes.first > last_column || first_indexes.second > last_row) {
+        return 0.0;
     }
 
-    return static_cast<double>(shaved_fields_number) / static_cast<double>(all_fields_number);
+    int64_t region_fields_number = static_cast<int64_t>(last_column - first_indexes.first + 1) * 
+        static_cast<int64_t>(last_row - first_indexes.second + 1);
+    int64_t shaved_fields_number = static_cast<int64_t>(grid_.countSetFieldsInArea(first_indexes.first, 
+        first_indexes.second, last_column, last_row));
+
+    return static_cast<double>(shaved_fields_number) / static_cast<double>(region_fields_number);
 }
 
 
 void Lawn::cutGrass(const pair<double, double>& blade_middle, const unsigned int& blade_diameter) {
-    /* Cut grass in circle shape. Iterates over all fields of minimal square in which all circle can be fit.
-        Each field is checked if it is in circle. If field is both in the circle and in the lawn as well, the field
-        is mowed. Otherwise the field is not mowed. */
+    /* Cut grass in circle shape. Field is mowed if it has 3 corners in range of blade or it has 2 corners in range 
+        of blade and also the middle of the field is in range (cutGrassSection and cutGrassAlongPath check only 
+        middles of the fields, so they may mark different fields on the border of the same circle). Circle is cut 
+        row by row: for every horizontal line of fields corners the range of corners inside the circle is found, 
+        fields having all corners in both ranges of the row are mowed at once and only the fields on the border 
+        of the circle are checked one by one */
 
     double DIAMETER_TO_RADIUS_DIVISION_FACTOR = 2.0;
+    double radius = static_cast<double>(blade_diameter) / DIAMETER_TO_RADIUS_DIVISION_FACTOR;
+    double squared_radius = radius * radius;
+
+    int64_t first_column = max(static_cast<int64_t>(floor((blade_middle.first - radius) / field_width_)), 
+        int64_t(0));
+    int64_t last_column = min(static_cast<int64_t>(floor((blade_middle.first + radius) / field_width_)), 
+        static_cast<int64_t>(grid_.getColumnsNumber()) - 1);
+    int64_t first_row = max(static_cast<int64_t>(floor((blade_middle.second - radius) / field_width_)), 
+        int64_t(0));
+    int64_t last_row = min(static_cast<int64_t>(floor((blade_middle.second + radius) / field_width_)), 
+        static_cast<int64_t>(grid_.getRowsNumber()) - 1);
+
+    if (first_column > last_column || first_row > last_row) {
+        return;
+    }
 
-    pair<double, double> first_coords = calculateFirstMowingFieldCoords(blade_middle, blade_diameter);
-    pair<unsigned int, unsigned int> first_indexes = calculateFieldIndexes(first_coords.first, first_coords.second);
-    double beginning_x = static_cast<double>(first_indexes.first) * Config::FIELD_WIDTH;
-    double beginning_y = static_cast<double>(first_indexes.second) * Config::FIELD_WIDTH;
-    double ending_x = min(beginning_x + blade_diameter, static_cast<double>(width_));
-    double ending_y = min(beginning_y + blade_diameter, static_cast<double>(length_));
-    double current_y = beginning_y;
-    double current_x = beginning_x;
-
-    while (current_y < ending_y) {
-        while (current_x < ending_x) {
-            if (isFieldInMowingArea(current_x, current_y, blade_middle, blade_diameter)) {
-                pair<unsigned int, unsigned int> indexes = calculateFieldIndexes(current_x, current_y);
-                cutGrassOnField(indexes);
-            }
-            current_x = current_x + Config::FIELD_WIDTH;
+    uint64_t mowed_fields_before = grid_.countSetFields();
+    pair<int64_t, int64_t> EMPTY_RANGE (1, 0);
+    pair<int64_t, int64_t> down_range = calculateCornersRangeInCircle(first_row, blade_middle, squared_radius, 
+        EMPTY_RANGE);
+
+    for (int64_t row = first_row; row <= last_row; ++row) {
+        pair<int64_t, int64_t> up_range = calculateCornersRangeInCircle(row + 1, blade_middle, squared_radius, 
+            down_range);
+        int64_t span_first_column = max(max(down_range.first, up_range.first), first_column);
+        int64_t span_last_column = min(min(down_range.second, up_range.second) - 1, last_column);
+        pair<int64_t, int64_t> corners_range = mergeCornersRanges(down_range, up_range);
+        int64_t border_first_column = max(corners_range.first - 1, first_column);
+        int64_t border_last_column = min(corners_range.second, last_column);
+
+        if (span_first_column <= span_last_column) {
+            grid_.setFieldsInRow(static_cast<unsigned int>(row), static_cast<unsigned int>(span_first_column), 
+                static_cast<unsigned int>(span_last_column));
+            cutCircleBorderFields(row, border_first_column, span_first_column - 1, down_range, up_range, 
+                blade_middle, squared_radius);
+            cutCircleBorderFields(row, span_last_column + 1, border_last_column, down_range, up_range, 
+                blade_middle, squared_radius);
         }
-        current_y = current_y + Config::FIELD_WIDTH;
-        current_x = beginning_x;
+        else {
+            cutCircleBorderFields(row, border_first_column, border_last_column, down_range, up_range, 
+                blade_middle, squared_radius);
+        }
+        down_range = up_range;
     }
-}
 
-
-pair<double, double> Lawn::calculateFirstMowingFieldCoords(const pair<double, double>& blade_middle, const double& blade_diameter) const {
-    // Calculate coords of the most left down field for mowing
-    
-    double DIAMETER_TO_RADIUS_DIVISION_FACTOR = 2.0;
-    double LEFT_DOWN_CORNER_COORD = 0.0;
-    double first_x = blade_middle.first - static_cast<double>(blade_diameter) / DIAMETER_TO_RADIUS_DIVISION_FACTOR;
-    double first_y = blade_middle.second - static_cast<double>(blade_diameter) / DIAMETER_TO_RADIUS_DIVISION_FACTOR;
-    
-    pair<double, double> coords = pair<double, double>(max(first_x, LEFT_DOWN_CORNER_COORD), 
-        max(first_y, LEFT_DOWN_CORNER_COORD));
-    return coords;
+    markRegionAsDirty(pair<unsigned int, unsigned int>(first_column, first_row), 
+        pair<unsigned int, unsigned int>(last_column, last_row), mowed_fields_before);
 }
 
 
-bool Lawn::isFieldInMowingArea(const double& x, const double& y, const std::pair<double, double>& blade_middle, 
-        const double& blade_diameter) const {
-    /* Check if field is in the range of mower's blade. Filed is mowed if it has 3 corners in range of blade or
-        it has 2 corners in range of mower's blade and also the middle of the field is in range */
+void Lawn::cutCircleBorderFields(const int64_t& row, const int64_t& first_column, const int64_t& last_column, 
+        const pair<int64_t, int64_t>& down_range, const pair<int64_t, int64_t>& up_range, 
+        const pair<double, double>& blade_middle, const double& squared_radius) {
+    /* Cut fields of the row, which are on the border of the circle. Field is mowed if it has 3 corners in range of
+        blade or it has 2 corners in range of blade and also the middle of the field is in range. Fields are checked
+        in groups belonging to one row of a tile: corners ranges give masks of corners in range, middles are checked
+        only for fields with 2 corners in range and the resulting mask is written to the grid at once */
+
+    int64_t column = first_column;
+
+    while (column <= last_column) {
+        int64_t tile_column = column / LawnGrid::TILE_SIZE;
+        int64_t tile_first_column = tile_column * LawnGrid::TILE_SIZE;
+        int64_t group_last_column = min(last_column, tile_first_column + LawnGrid::TILE_SIZE - 1);
+
+        uint64_t group_mask = calculateRangeMask(tile_first_column, 
+            pair<int64_t, int64_t>(column, group_last_column));
+        uint64_t down_left_corners = calculateRangeMask(tile_first_column, down_range);
+        uint64_t down_right_corners = calculateRangeMask(tile_first_column, 
+            pair<int64_t, int64_t>(down_range.first - 1, down_range.second - 1));
+        uint64_t up_left_corners = calculateRangeMask(tile_first_column, up_range);
+        uint64_t up_right_corners = calculateRangeMask(tile_first_column, 
+            pair<int64_t, int64_t>(up_range.first - 1, up_range.second - 1));
+
+        uint64_t any_down_corner = down_left_corners | down_right_corners;
+        uint64_t any_up_corner = up_left_corners | up_right_corners;
+        uint64_t both_down_corners = down_left_corners & down_right_corners;
+        uint64_t both_up_corners = up_left_corners & up_right_corners;
+
+        uint64_t at_least_two_corners = both_down_corners | both_up_corners | (any_down_corner & any_up_corner);
+        uint64_t at_least_three_corners = (both_down_corners & any_up_corner) | (both_up_corners & any_down_corner);
+        uint64_t two_corners = at_least_two_corners & ~at_least_three_corners;
+        uint64_t middles = 0;
+
+        if (two_corners & group_mask) {
+            double FIELD_MIDDLE_FACTOR = 0.5;
+            double dy = (static_cast<double>(row) + FIELD_MIDDLE_FACTOR) * field_width_ - blade_middle.second;
+            for (int64_t middle_column = column; middle_column <= group_last_column; ++middle_column) {
+                double dx = (static_cast<double>(middle_column) + FIELD_MIDDLE_FACTOR) * field_width_ 
+                    - blade_middle.first;
+                if (dx * dx + dy * dy <= squared_radius) {
+                    middles |= uint64_t(1) << (middle_column - tile_first_column);
+                }
+            }
+        }
 
-    unsigned int counter = countCornersInArea(x, y, blade_middle, blade_diameter);
-    
-    if (counter > 2) {
-        return true;
-    }
-    else if (counter == 2) {
-        return calculateDistanceBetweenPoints(x + Config::FIELD_WIDTH / 2.0, y + Config::FIELD_WIDTH / 2.0,
-            blade_middle) <= blade_diameter / 2;
-    }
-    else {
-        return false;
+        grid_.setFieldsInTileRow(static_cast<unsigned int>(tile_column), static_cast<unsigned int>(row), 
+            (at_least_three_corners | (two_corners & middles)) & group_mask);
+        column = group_last_column + 1;
     }
 }
 
 
-unsigned int Lawn::countCornersInArea(const double& x, const double& y, const std::pair<double, double>& blade_middle, 
-        const double& blade_diameter) const {
-    // Calculates how many corners are in area accessible for blade
+uint64_t Lawn::calculateRangeMask(const int64_t& tile_first_column, const pair<int64_t, int64_t>& range) {
+    // Calculate mask of one tile row, in which bits of columns from range are set
 
-    pair<double, double> points[4] = {
-        {x, y},
-        {x + Config::FIELD_WIDTH, y},
-        {x + Config::FIELD_WIDTH, y + Config::FIELD_WIDTH},
-        {x, y + Config::FIELD_WIDTH}
-    };
+    int64_t first_bit = max(range.first - tile_first_column, int64_t(0));
+    int64_t last_bit = min(range.second - tile_first_column, static_cast<int64_t>(LawnGrid::TILE_SIZE) - 1);
 
-    unsigned int counter = 0;
-    for (pair<double, double> point : points) {
-        if (calculateDistanceBetweenPoints(point.first, point.second, blade_middle) <= blade_diameter / 2.0) {
-            counter ++;
-        }
+    if (first_bit > last_bit) {
+        return 0;
     }
 
-    return counter;
+    uint64_t ALL_BITS = ~uint64_t(0);
+    return (ALL_BITS >> (LawnGrid::TILE_SIZE - 1 - last_bit)) & (ALL_BITS << first_bit);
 }
 
 
-double Lawn::calculateDistanceBetweenPoints(const double& x, const double& y, 
-    const std::pair<double, double>& destination_point) const {
-    // Calculate distance between two points
+bool Lawn::isCornerInCircle(const int64_t& column, const int64_t& row, const pair<double, double>& blade_middle, 
+        const double& squared_radius) const {
+    // Check if corner of the fields is in range of blade. Compares squared distances, so no square root is needed
 
-    double dx = x - destination_point.first;
-    double dy = y - destination_point.second;
+    double dx = static_cast<double>(column) * field_width_ - blade_middle.first;
+    double dy = static_cast<double>(row) * field_width_ - blade_middle.second;
 
-    return std::sqrt(dx * dx + dy * dy);
+    return dx * dx + dy * dy <= squared_radius;
 }
 
 
-void Lawn::cutGrassSection(const std::pair<double, double>& blade_middle_beginning, const unsigned int& blade_diameter,
-    const std::pair<double, double>& blade_middle_ending, const unsigned short& angle) {
-    // Cuts grass area, which contsists of two circles and one rectangle
- 
-    cutGrass(blade_middle_beginning, blade_diameter);
-    cutRectangularGrass(blade_middle_beginning, blade_diameter, blade_middle_ending, angle);
-    cutGrass(blade_middle_ending, blade_diameter);
-}
+pair<int64_t, int64_t> Lawn::calculateCornersRangeInCircle(const int64_t& row, 
+        const pair<double, double>& blade_middle, const double& squared_radius, 
+        const pair<int64_t, int64_t>& previous_range) const {
+    /* Calculate range of corners indexes of the horizontal line, which are in range of blade. Corner nearest to 
+        the blade middle is checked first, if it is outside the circle, so are all others and empty range (first 
+        bigger than last) is returned. Otherwise range borders are moved from range of the previous line one corner 
+        at a time, so the whole circle needs number of steps proportional to its diameter */
 
+    int64_t middle_column = static_cast<int64_t>(llround(blade_middle.first / field_width_));
 
-void Lawn::cutRectangularGrass(const std::pair<double, double>& blade_middle_beginning, 
-    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
-    const unsigned short& angle) {
-    // Cuts rectangular shaped grass. Provides correct mowing mode, depends on the position of rectangle
+    if (!isCornerInCircle(middle_column, row, blade_middle, squared_radius)) {
+        return pair<int64_t, int64_t>(1, 0);
+    }
 
-    
-    if (angle % 90 == 0) {
-        cutVerticalRectangle(blade_middle_beginning, blade_diameter, blade_middle_ending);
+    bool is_previous_range_empty = previous_range.first > previous_range.second;
+    int64_t first = is_previous_range_empty ? middle_column : min(previous_range.first, middle_column);
+    int64_t last = is_previous_range_empty ? middle_column : max(previous_range.second, middle_column);
+
+    if (isCornerInCircle(first, row, blade_middle, squared_radius)) {
+        while (isCornerInCircle(first - 1, row, blade_middle, squared_radius)) --first;
+    }
+    else {
+        while (!isCornerInCircle(first, row, blade_middle, squared_radius)) ++first;
+    }
+    if (isCornerInCircle(last, row, blade_middle, squared_radius)) {
+        while (isCornerInCircle(last + 1, row, blade_middle, squared_radius)) ++last;
     }
     else {
-        cutTiltedRectangle(blade_middle_beginning, blade_diameter, blade_middle_ending, angle);
+        while (!isCornerInCircle(last, row, blade_middle, squared_radius)) --last;
     }
+
+    return pair<int64_t, int64_t>(first, last);
 }
 
 
-void Lawn::cutTiltedRectangle(const std::pair<double, double>& blade_middle_beginning, 
-    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending, 
-    const unsigned short& angle) {
-    /* Cuts grass in tilted rectangular shape. Iterates through fields which are located inside the big 
-    not tilted rectangle, which is the minimal rectangle, in which mowing rectangular area can be fit. 
-    If field is both in big rectangle and small rectangle it is mowed.*/ 
+pair<int64_t, int64_t> Lawn::mergeCornersRanges(const pair<int64_t, int64_t>& first_range, 
+        const pair<int64_t, int64_t>& second_range) {
+    // Calculate the smallest range containing both ranges. Empty range (first bigger than last) is skipped
 
-    double angle_in_radians = MathHelper::convertDegreesToRadians(angle);
-    double a_mower_path = MathHelper::calculateAParameter(angle);
-    double a_perpendicular = MathHelper::calculateAPerpendicularParameter(a_mower_path);
+    if (first_range.first > first_range.second) {
+        return second_range;
+    }
+    if (second_range.first > second_range.second) {
+        return first_range;
+    }
 
-    double DIAMETER_TO_RADIUS_FACTOR = 2;
-    double blade_radius = blade_diameter / DIAMETER_TO_RADIUS_FACTOR;
+    return pair<int64_t, int64_t>(min(first_range.first, second_range.first), 
+        max(first_range.second, second_range.second));
+}
 
-    double x_left_beginning = blade_middle_beginning.first - cos(angle_in_radians) * blade_radius;
-    double x_right_beginning = blade_middle_beginning.first + cos(angle_in_radians) * blade_radius;
-    double x_left_ending = blade_middle_ending.first - cos(angle_in_radians) * blade_radius;
-    double x_right_ending = blade_middle_ending.first + cos(angle_in_radians) * blade_radius;
 
-    double b_horizontal_beginning = blade_middle_beginning.second - a_perpendicular * blade_middle_beginning.first;
-    double b_horizontal_ending = blade_middle_ending.second - a_perpendicular * blade_middle_ending.first;
+void Lawn::cutGrassSection(const std::pair<double, double>& blade_middle_beginning, const unsigned int& blade_diameter,
+    const std::pair<double, double>& blade_middle_ending) {
+    /* Cuts grass area swept by the blade between two points: two half circles and one rectangle (capsule). 
+        Field is mowed when its middle is inside the capsule - unlike cutGrass, which uses corners of the fields, 
+        so a section of zero length and cutGrass of the same circle may differ by fields on the circle's border */
+    TRACE_SCOPE("Lawn::cutGrassSection");
+ 
+    pair<double, double> path[] = {blade_middle_beginning, blade_middle_ending};
+    cutCapsules(path, 2, blade_diameter);
+}
 
-    double y_left_beginning = a_perpendicular * x_left_beginning + b_horizontal_beginning;
-    double y_right_beginning = a_perpendicular * x_right_beginning + b_horizontal_beginning;
-    double y_left_ending = a_perpendicular * x_left_ending + b_horizontal_ending;
-    double y_right_ending = a_perpendicular * x_right_ending + b_horizontal_ending;
 
-    double b_vertical_left = y_left_beginning - a_mower_path * x_left_beginning;
-    double b_vertical_right = y_right_beginning - a_mower_path * x_right_beginning;
+void Lawn::cutGrassAlongPath(const vector<pair<double, double>>& path, const unsigned int& blade_diameter) {
+    /* Cut grass swept by the blade moving along the path (blade middles in order). Each section of the path cuts 
+        a capsule: circles at both ends joined by a rectangle. Field is mowed when its middle is inside any capsule */
 
-    double max_b_horizontal = max(b_horizontal_beginning, b_horizontal_ending);
-    double min_b_horizontal = min(b_horizontal_beginning, b_horizontal_ending);
-    double max_b_vertical = max(b_vertical_left, b_vertical_right);
-    double min_b_vertical = min(b_vertical_left, b_vertical_right);
-       
-    double left_side_x = min(x_left_beginning, x_left_ending);
-    double right_side_x = max(x_right_beginning, x_right_ending);
+    cutCapsules(path.data(), path.size(), blade_diameter);
+}
 
-    double up_side_y = max(max(y_left_beginning, y_right_beginning), max(y_left_ending, y_right_ending));
-    double down_side_y = min(min(y_left_beginning, y_right_beginning), min(y_left_ending, y_right_ending));
 
-    pair<double, double> addition_factors = calculateAdditionFactors(angle);     
+void Lawn::cutCapsules(const pair<double, double>* path, const size_t& points_number, 
+        const unsigned int& blade_diameter) {
+    /* Cut capsules of the sections between consecutive points of the path (single point cuts a circle). 
+        Capsules are convex, so middle line of every row of fields crosses each of them in one section. Sections 
+        of the row are merged and every merged range of fields is mowed once, even if many capsules cover it */
 
-    double start_y = (addition_factors.second > 0) ? down_side_y : up_side_y;
-    double end_y   = (addition_factors.second > 0) ? up_side_y : down_side_y;
-    double start_x = (addition_factors.first > 0) ? left_side_x : right_side_x;
-    double end_x   = (addition_factors.first > 0) ? right_side_x : left_side_x;
+    if (points_number == 0) {
+        return;
+    }
 
-    double current_y = start_y;
-    while ((addition_factors.second > 0 && current_y <= end_y) ||
-        (addition_factors.second < 0 && current_y >= end_y)) {
-        double current_x = start_x;
+    double DIAMETER_TO_RADIUS_FACTOR = 2;
+    double FIELD_MIDDLE_FACTOR = 0.5;
+    double blade_radius = blade_diameter / DIAMETER_TO_RADIUS_FACTOR;
 
-        while ((addition_factors.first > 0 && current_x <= end_x) ||
-            (addition_factors.first < 0 && current_x >= end_x)) {
-            double b_horizontal = current_y - a_perpendicular * current_x;
-            double b_vertical = current_y - a_mower_path * current_x;
+    double down_side_y = path[0].second;
+    double up_side_y = path[0].second;
+    for (size_t i = 1; i < points_number; ++i) {
+        down_side_y = min(down_side_y, path[i].second);
+        up_side_y = max(up_side_y, path[i].second);
+    }
 
-            if (min_b_horizontal <= b_horizontal && b_horizontal <= max_b_horizontal &&
-                min_b_vertical <= b_vertical && b_vertical <= max_b_vertical &&
-                isPointInLawn(current_x, current_y)) {
+    int64_t first_row = max(calculateFirstFieldIndexAfter(down_side_y - blade_radius), int64_t(0));
+    int64_t last_row = min(calculateLastFieldIndexBefore(up_side_y + blade_radius), 
+        static_cast<int64_t>(grid_.getRowsNumber()) - 1);
+    int64_t first_mowed_column = static_cast<int64_t>(grid_.getColumnsNumber());
+    int64_t last_mowed_column = -1;
+    uint64_t mowed_fields_before = grid_.countSetFields();
+    size_t sections_number = max(points_number - 1, size_t(1));
+
+    for (int64_t row = first_row; row <= last_row; ++row) {
+        double row_middle_y = (static_cast<double>(row) + FIELD_MIDDLE_FACTOR) * field_width_;
+        row_ranges_.clear();
+
+        for (size_t i = 0; i < sections_number; ++i) {
+            const pair<double, double>& beginning = path[i];
+            const pair<double, double>& ending = path[min(i + 1, points_number - 1)];
+            pair<double, double> row_section = calculateCapsuleSectionOnLine(beginning, ending, blade_radius, 
+                row_middle_y);
+            if (row_section.first > row_section.second) {
+                continue;
+            }
 
-                pair<unsigned int, unsigned int> indexes = calculateFieldIndexes(current_x, current_y);
-                cutGrassOnField(indexes); 
+            int64_t first_column = max(calculateFirstFieldIndexAfter(row_section.first), int64_t(0));
+            int64_t last_column = min(calculateLastFieldIndexBefore(row_section.second), 
+                static_cast<int64_t>(grid_.getColumnsNumber()) - 1);
+            if (first_column <= last_column) {
+                row_ranges_.push_back(pair<int64_t, int64_t>(first_column, last_column));
             }
-            current_x += addition_factors.first;
         }
-        current_y += addition_factors.second;
+        if (row_ranges_.empty()) {
+            continue;
+        }
+
+        sort(row_ranges_.begin(), row_ranges_.end());
+        pair<int64_t, int64_t> merged_range = row_ranges_[0];
+        for (size_t i = 1; i <= row_ranges_.size(); ++i) {
+            if (i < row_ranges_.size() && row_ranges_[i].first <= merged_range.second + 1) {
+                merged_range.second = max(merged_range.second, row_ranges_[i].second);
+                continue;
+            }
+            grid_.setFieldsInRow(static_cast<unsigned int>(row), static_cast<unsigned int>(merged_range.first), 
+                static_cast<unsigned int>(merged_range.second));
+            if (i < row_ranges_.size()) {
+                merged_range = row_ranges_[i];
+            }
+        }
+        first_mowed_column = min(first_mowed_column, row_ranges_.front().first);
+        last_mowed_column = max(last_mowed_column, merged_range.second);
+    }
+
+    if (first_mowed_column <= last_mowed_column) {
+        markRegionAsDirty(pair<unsigned int, unsigned int>(first_mowed_column, first_row), 
+            pair<unsigned int, unsigned int>(last_mowed_column, last_row), mowed_fields_before);
     }
 }
 
 
-pair<double, double> Lawn::calculateAdditionFactors(const unsigned short& angle) {
-    // Calculate addition factor for fields for iteration in nested loop, depending on angle.
+pair<double, double> Lawn::calculateCapsuleSectionOnLine(const pair<double, double>& beginning, 
+        const pair<double, double>& ending, const double& radius, const double& y) {
+    /* Calculate x coords of the leftmost and the rightmost point of horizontal line, which are not further than 
+        radius from section between beginning and ending. It is the union of sections cut from the line by both 
+        end circles and by the rectangle between them. If line does not cross the capsule, empty section (first 
+        bigger than second) is returned */
 
-    double x_addition_factor = Config::FIELD_WIDTH;
-    double y_addition_factor = Config::FIELD_WIDTH;
+    double left_x = INFINITY;
+    double right_x = -INFINITY;
 
-    if (angle > 90 && angle < 180) {
-        y_addition_factor *= -1;
-    }
-    else if (angle > 180 && angle < 270) {
-        x_addition_factor *= -1;
-        y_addition_factor *= -1;
+    for (const pair<double, double>& end_point : {beginning, ending}) {
+        double dy = y - end_point.second;
+        if (dy * dy <= radius * radius) {
+            double half_chord = sqrt(radius * radius - dy * dy);
+            left_x = min(left_x, end_point.first - half_chord);
+            right_x = max(right_x, end_point.first + half_chord);
+        }
     }
-    else if (angle > 270 && angle < 360){
-        x_addition_factor *= -1;
+
+    double dx = ending.first - beginning.first;
+    double dy = ending.second - beginning.second;
+    double length = sqrt(dx * dx + dy * dy);
+    if (length > 0.0) {
+        double x_shift = -dy / length * radius;
+        double y_shift = dx / length * radius;
+        pair<double, double> corners[] = {
+            {beginning.first + x_shift, beginning.second + y_shift},
+            {ending.first + x_shift, ending.second + y_shift},
+            {ending.first - x_shift, ending.second - y_shift},
+            {beginning.first - x_shift, beginning.second - y_shift}
+        };
+        pair<double, double> rectangle_section = calculatePolygonSectionOnLine(corners, 4, y);
+        left_x = min(left_x, rectangle_section.first);
+        right_x = max(right_x, rectangle_section.second);
     }
 
-    return pair<double, double> (x_addition_factor, y_addition_factor);
+    return pair<double, double>(left_x, right_x);
 }
 
 
-void Lawn::cutVerticalRectangle(const std::pair<double, double>& blade_middle_beginning, 
-    const unsigned int& blade_diameter, const std::pair<double, double>& blade_middle_ending) {
-    // Cut grass in not tilted rectangular shape. Simplified version of default tilted rectangle mowing 
-
-    double DIAMETER_TO_RADIUS_FACTOR = 2;
-    double blade_radius = blade_diameter / DIAMETER_TO_RADIUS_FACTOR;
+pair<double, double> Lawn::calculatePolygonSectionOnLine(const pair<double, double>* corners, 
+        const size_t& corners_number, const double& y) {
+    /* Calculate x coords of the leftmost and the rightmost point, in which horizontal line crosses border of convex 
+        polygon. If line does not cross the polygon, empty section (first bigger than second) is returned */
 
-    double beginning_x = blade_middle_beginning.first;
-    double beginning_y = blade_middle_beginning.second;
-    double ending_x = blade_middle_ending.first;
-    double ending_y = blade_middle_ending.second;
-
-    double left_side_x;
-    double down_side_y;
-    double right_side_x;
-    double up_side_y;
-    if (beginning_x - ending_x == 0) {
-        left_side_x = max(beginning_x - blade_radius, 0.0);
-        down_side_y = max(min(beginning_y, ending_y), 0.0);
-        right_side_x = min(double(width_), beginning_x + blade_radius);
-        up_side_y = min(max(beginning_y, ending_y), double(length_));
-    }
-    else {
-        left_side_x = max(min(beginning_x, ending_x), 0.0);
-        down_side_y = max(beginning_y - blade_radius, 0.0);
-        right_side_x = min(max(beginning_x, ending_x), double(width_));
-        up_side_y = min(beginning_y + blade_radius, double(length_));
-    }
+    double left_x = INFINITY;
+    double right_x = -INFINITY;
 
-    pair<unsigned int, unsigned int> indexes = calculateFieldIndexes(left_side_x, down_side_y);
-    beginning_x = indexes.first * Config::FIELD_WIDTH + Config::FIELD_WIDTH / 2;
-    beginning_y = indexes.second * Config::FIELD_WIDTH + Config::FIELD_WIDTH / 2;
+    for (size_t i = 0; i < corners_number; ++i) {
+        const pair<double, double>& first_corner = corners[i];
+        const pair<double, double>& second_corner = corners[(i + 1) % corners_number];
+        double lower_y = min(first_corner.second, second_corner.second);
+        double upper_y = max(first_corner.second, second_corner.second);
 
-    for (double current_y = beginning_y; current_y <= up_side_y; current_y += Config::FIELD_WIDTH) {
-        for (double current_x = beginning_x; current_x <= right_side_x; current_x += Config::FIELD_WIDTH) {
-            pair<unsigned int, unsigned int> indexes = calculateFieldIndexes(current_x, current_y);
-            cutGrassOnField(indexes);
+        if (y < lower_y || y > upper_y) {
+            continue;
+        }
+        if (first_corner.second == second_corner.second) {
+            left_x = min(left_x, min(first_corner.first, second_corner.first));
+            right_x = max(right_x, max(first_corner.first, second_corner.first));
+        }
+        else {
+            double x = first_corner.first + (y - first_corner.second) * 
+                (second_corner.first - first_corner.first) / (second_corner.second - first_corner.second);
+            left_x = min(left_x, x);
+            right_x = max(right_x, x);
         }
     }
+
+    return pair<double, double>(left_x, right_x);
+}
+
+
+int64_t Lawn::calculateFirstFieldIndexAfter(const double& coord_value) const {
+    // Calculate index of the first field, which middle is not closer than coord value
+
+    double FIELD_MIDDLE_FACTOR = 0.5;
+
+    return static_cast<int64_t>(ceil(coord_value / field_width_ - FIELD_MIDDLE_FACTOR));
+}
+
+
+int64_t Lawn::calculateLastFieldIndexBefore(const double& coord_value) const {
+    // Calculate index of the last field, which middle is not further than coord value
+
+    double FIELD_MIDDLE_FACTOR = 0.5;
+
+    return static_cast<int64_t>(floor(coord_value / field_width_ - FIELD_MIDDLE_FACTOR));
 }
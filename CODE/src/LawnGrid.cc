@@ -0,0 +1,278 @@
+/*
+    Author: Maciej Cieslik
+
+    Implements LawnGrid class.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include "LawnGrid.h"
+
+using namespace std;
+
+
+LawnGrid::LawnGrid() : LawnGrid(0, 0) {}
+
+
+LawnGrid::LawnGrid(const unsigned int& columns_number, const unsigned int& rows_number)
+    : columns_number_(columns_number), rows_number_(rows_number),
+    horizontal_tiles_number_((columns_number + TILE_SIZE - 1) / TILE_SIZE),
+    vertical_tiles_number_((rows_number + TILE_SIZE - 1) / TILE_SIZE),
+    tiles_(static_cast<size_t>(horizontal_tiles_number_) * vertical_tiles_number_, make_shared<Tile>()),
+    set_fields_counter_(0) {}
+
+
+bool LawnGrid::operator==(const LawnGrid& other) const {
+    // Compare grids tile by tile, tiles shared by both grids are equal without comparing their content
+
+    if (this->columns_number_ != other.getColumnsNumber() || this->rows_number_ != other.getRowsNumber()) {
+        return false;
+    }
+
+    for (size_t tile_index = 0; tile_index < tiles_.size(); ++tile_index) {
+        const Tile& tile = *tiles_[tile_index];
+        const Tile& other_tile = *other.tiles_[tile_index];
+
+        if (&tile != &other_tile && memcmp(tile.rows_, other_tile.rows_, sizeof(tile.rows_)) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+bool LawnGrid::operator!=(const LawnGrid& other) const {
+    return !((*this) == other);
+}
+
+
+unsigned int LawnGrid::getColumnsNumber() const {
+    return columns_number_;
+}
+
+
+unsigned int LawnGrid::getRowsNumber() const {
+    return rows_number_;
+}
+
+
+unsigned int LawnGrid::getHorizontalTilesNumber() const {
+    return horizontal_tiles_number_;
+}
+
+
+unsigned int LawnGrid::getVerticalTilesNumber() const {
+    return vertical_tiles_number_;
+}
+
+
+bool LawnGrid::isEmpty() const {
+    return columns_number_ == 0 || rows_number_ == 0;
+}
+
+
+bool LawnGrid::getField(const unsigned int& column, const unsigned int& row) const {
+    // Check if the grass on the field is cut
+
+    if (column >= columns_number_ || row >= rows_number_) {
+        return false;
+    }
+
+    return (getTileRow(column / TILE_SIZE, row) >> (column % TILE_SIZE)) & 1u;
+}
+
+
+uint64_t LawnGrid::getTileRow(const unsigned int& tile_column, const unsigned int& row) const {
+    // Return one row of a tile. Bit n of the word describes field in column tile_column * TILE_SIZE + n
+
+    return tiles_[calculateTileIndex(tile_column, row / TILE_SIZE)]->rows_[row % TILE_SIZE];
+}
+
+
+bool LawnGrid::hasSameTile(const LawnGrid& other, const unsigned int& tile_column,
+        const unsigned int& tile_row) const {
+    /* Check if both grids share the same tile (e.g. snapshot and the lawn it was taken from). Shared tiles
+        were not changed since the copy was made */
+
+    size_t tile_index = calculateTileIndex(tile_column, tile_row);
+
+    return tile_index < other.tiles_.size() && tiles_[tile_index] == other.tiles_[tile_index];
+}
+
+
+void LawnGrid::setField(const unsigned int& column, const unsigned int& row) {
+    /* Change field state to mowed. Fields outside the grid are ignored, so that padding bits of the last
+        tiles always stay zero */
+
+    if (column >= columns_number_ || row >= rows_number_) {
+        return;
+    }
+
+    setBitsInWord(column / TILE_SIZE, row, uint64_t(1) << (column % TILE_SIZE));
+}
+
+
+void LawnGrid::setFieldsInRow(const unsigned int& row, const unsigned int& first_column,
+        const unsigned int& last_column) {
+    /* Change state of all fields in [first_column, last_column] range of the row to mowed. Works on whole
+        words, so at most one write per tile is done. Range is clipped to the grid */
+
+    if (row >= rows_number_ || first_column >= columns_number_ || first_column > last_column) {
+        return;
+    }
+
+    unsigned int clipped_last_column = min(last_column, columns_number_ - 1);
+    unsigned int first_tile = first_column / TILE_SIZE;
+    unsigned int last_tile = clipped_last_column / TILE_SIZE;
+
+    for (unsigned int tile = first_tile; tile <= last_tile; ++tile) {
+        unsigned int first_bit = (tile == first_tile) ? first_column % TILE_SIZE : 0;
+        unsigned int last_bit = (tile == last_tile) ? clipped_last_column % TILE_SIZE : TILE_SIZE - 1;
+
+        setBitsInWord(tile, row, calculateBitsMask(first_bit, last_bit));
+    }
+}
+
+
+void LawnGrid::setFieldsInTileRow(const unsigned int& tile_column, const unsigned int& row, const uint64_t& mask) {
+    /* Change state of fields of one tile row to mowed. Bit n of the mask describes field in column 
+        tile_column * TILE_SIZE + n. Bits of fields outside the grid are ignored */
+
+    if (tile_column >= horizontal_tiles_number_ || row >= rows_number_) {
+        return;
+    }
+
+    unsigned int first_column = tile_column * TILE_SIZE;
+    unsigned int last_bit = min(columns_number_ - first_column, TILE_SIZE) - 1;
+
+    setBitsInWord(tile_column, row, mask & calculateBitsMask(0, last_bit));
+}
+
+
+void LawnGrid::setBitsInWord(const unsigned int& tile_column, const unsigned int& row, const uint64_t& mask) {
+    // Set bits of the word and update counters by the number of fields, which changed from not mowed to mowed
+
+    uint64_t word = getTileRow(tile_column, row);
+    unsigned int newly_set_bits = static_cast<unsigned int>(__builtin_popcountll(mask & ~word));
+
+    if (newly_set_bits == 0) {
+        return;
+    }
+    Tile& tile = getWritableTile(tile_column, row / TILE_SIZE);
+    tile.rows_[row % TILE_SIZE] = word | mask;
+    tile.set_fields_counter_ += newly_set_bits;
+    set_fields_counter_ += newly_set_bits;
+}
+
+
+LawnGrid::Tile& LawnGrid::getWritableTile(const unsigned int& tile_column, const unsigned int& tile_row) {
+    /* Return tile, which can be changed in place. Tile shared with other grid is cloned first, so the other
+        grid still sees the old state. Acquire fence makes sure, that all reads of the tile done by the last other
+        owner (possibly in another thread) are finished before the tile is modified */
+
+    shared_ptr<Tile>& tile = tiles_[calculateTileIndex(tile_column, tile_row)];
+
+    if (tile.use_count() > 1) {
+        tile = make_shared<Tile>(*tile);
+    }
+    else {
+        atomic_thread_fence(memory_order_acquire);
+    }
+
+    return *tile;
+}
+
+
+uint64_t LawnGrid::countSetFields() const {
+    return set_fields_counter_;
+}
+
+
+unsigned int LawnGrid::countSetFieldsInTile(const unsigned int& tile_column, const unsigned int& tile_row) const {
+    return tiles_[calculateTileIndex(tile_column, tile_row)]->set_fields_counter_;
+}
+
+
+uint64_t LawnGrid::countSetFieldsInArea(const unsigned int& first_column, const unsigned int& first_row,
+        const unsigned int& last_column, const unsigned int& last_row) const {
+    /* Count mowed fields in rectangular area (borders included). Tiles covered entirely by the area are counted 
+        with tile counters, only the tiles on the area's border are counted word by word */
+
+    if (first_column >= columns_number_ || first_row >= rows_number_ || 
+        first_column > last_column || first_row > last_row) {
+        return 0;
+    }
+
+    unsigned int clipped_last_column = min(last_column, columns_number_ - 1);
+    unsigned int clipped_last_row = min(last_row, rows_number_ - 1);
+    uint64_t counter = 0;
+
+    for (unsigned int tile_row = first_row / TILE_SIZE; tile_row <= clipped_last_row / TILE_SIZE; ++tile_row) {
+        unsigned int tile_first_row = max(first_row, tile_row * TILE_SIZE);
+        unsigned int tile_last_row = min(clipped_last_row, tile_row * TILE_SIZE + TILE_SIZE - 1);
+
+        for (unsigned int tile_column = first_column / TILE_SIZE; tile_column <= clipped_last_column / TILE_SIZE; 
+            ++tile_column) {
+            unsigned int tile_first_column = max(first_column, tile_column * TILE_SIZE);
+            unsigned int tile_last_column = min(clipped_last_column, tile_column * TILE_SIZE + TILE_SIZE - 1);
+            bool is_whole_tile = tile_first_row % TILE_SIZE == 0 && tile_last_row % TILE_SIZE == TILE_SIZE - 1 &&
+                tile_first_column % TILE_SIZE == 0 && tile_last_column % TILE_SIZE == TILE_SIZE - 1;
+
+            if (is_whole_tile) {
+                counter += countSetFieldsInTile(tile_column, tile_row);
+            }
+            else {
+                uint64_t mask = calculateBitsMask(tile_first_column % TILE_SIZE, tile_last_column % TILE_SIZE);
+                counter += countSetFieldsInTilePart(tile_column, tile_first_row, tile_last_row, mask);
+            }
+        }
+    }
+
+    return counter;
+}
+
+
+uint64_t LawnGrid::countSetFieldsInTilePart(const unsigned int& tile_column, const unsigned int& first_row,
+        const unsigned int& last_row, const uint64_t& mask) const {
+    // Count mowed fields in given rows of the tile, only bits included in mask are counted
+
+    uint64_t counter = 0;
+    for (unsigned int row = first_row; row <= last_row; ++row) {
+        counter += static_cast<uint64_t>(__builtin_popcountll(getTileRow(tile_column, row) & mask));
+    }
+
+    return counter;
+}
+
+
+vector<vector<bool>> LawnGrid::toFields() const {
+    // Convert grid to 2-dimensional vector. Outer vector represents rows, inner represents columns
+
+    vector<vector<bool>> fields(rows_number_, vector<bool>(columns_number_, false));
+
+    for (unsigned int row = 0; row < rows_number_; ++row) {
+        for (unsigned int column = 0; column < columns_number_; ++column) {
+            fields[row][column] = getField(column, row);
+        }
+    }
+
+    return fields;
+}
+
+
+size_t LawnGrid::calculateTileIndex(const unsigned int& tile_column, const unsigned int& tile_row) const {
+    return static_cast<size_t>(tile_row) * horizontal_tiles_number_ + tile_column;
+}
+
+
+uint64_t LawnGrid::calculateBitsMask(const unsigned int& first_bit, const unsigned int& last_bit) {
+    // Calculate mask with all bits in [first_bit, last_bit] range set
+
+    uint64_t ALL_BITS = ~uint64_t(0);
+    uint64_t upper_mask = ALL_BITS >> (TILE_SIZE - 1 - last_bit);
+    uint64_t lower_mask = ALL_BITS << first_bit;
+
+    return upper_mask & lower_mask;
+}
@@ -4,24 +4,18 @@
     Implements Log class.
 */
 
+#include <utility>
 #include "Log.h"
 
 using namespace std;
 
 
-Log::Log(const u_int64_t& time, const string& message) : time_(time), message_(message) {}
+Log::Log(const u_int64_t& time, const string& message, const bool& is_error) : time_(time), message_(message), 
+    is_error_(is_error) {}
 
 
-Log::Log(const Log& other) : time_(other.getTime()), message_(other.getMessage()) {}
-
-
-Log& Log::operator=(const Log& other) {
-    if (this != &other) {
-        time_ = other.getTime();
-        message_ = other.getMessage();
-    }
-    return *this;
-}
+Log::Log(const u_int64_t& time, string&& message, const bool& is_error) : time_(time), message_(move(message)), 
+    is_error_(is_error) {}
 
 
 u_int64_t Log::getTime() const {
@@ -29,13 +23,26 @@ u_int64_t Log::getTime() const {
 }
 
 
-string Log::getMessage() const {
+const string& Log::getMessage() const {
     return message_;
 }
 
 
+bool Log::isError() const {
+    return is_error_;
+}
+
+
+string Log::releaseMessage() {
+    // Move message out of the log, leaving it empty
+
+    return move(message_);
+}
+
+
 bool Log::operator==(const Log& other) const {
-    return this->time_ == other.getTime() && this->message_ == other.getMessage();
+    return this->time_ == other.getTime() && this->message_ == other.getMessage() && 
+        this->is_error_ == other.isError();
 }
 
 
@@ -0,0 +1,75 @@
+/*
+    Author: Maciej Cieslik
+
+    Entry point of mower_logdump - offline decoder of binary logs saved by FileLogger.
+    Prints every record of the given files in the same text format as text logs.
+
+    Usage: mower_logdump <binary_log> [<binary_log> ...]
+*/
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "Exceptions.h"
+#include "LogEvent.h"
+
+using namespace std;
+
+
+bool dumpFile(const char* path) {
+    ifstream input(path, ios::binary);
+    if (!input) {
+        cerr << "[LogDump] Unable to open file: " << path << endl;
+        return false;
+    }
+
+    char header[sizeof(LogEvent::BINARY_LOG_HEADER)];
+    if (!input.read(header, sizeof(header)) || memcmp(header, LogEvent::BINARY_LOG_HEADER, sizeof(header)) != 0) {
+        cerr << "[LogDump] Not a binary mower log: " << path << endl;
+        return false;
+    }
+
+    LogEvent event;
+    string text;
+    try {
+        while (LogEvent::readRecord(input, event, text)) {
+            if (event.type_ == LogEventType::TEXT) {
+                cout << LogEvent::formatLine(event.time_, event.has_time_, text) << '\n';
+            } else {
+                cout << event.formatLine() << '\n';
+            }
+        }
+    } catch (const CorruptLogRecordError& error) {
+        cerr << "[LogDump] " << error.what() << " in file: " << path << endl;
+        return false;
+    }
+
+    if (!input.eof()) {
+        cerr << "[LogDump] Error while reading file: " << path << endl;
+        return false;
+    }
+    if (input.gcount() != 0) {
+        cerr << "[LogDump] Truncated record at the end of file: " << path << endl;
+        return false;
+    }
+    return true;
+}
+
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        cerr << "Usage: " << argv[0] << " <binary_log> [<binary_log> ...]" << endl;
+        return 1;
+    }
+
+    int result = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (!dumpFile(argv[i])) {
+            result = 1;
+        }
+    }
+    cout.flush();
+
+    return result;
+}
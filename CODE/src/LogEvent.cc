@@ -0,0 +1,271 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Implements LogEvent structure.
+*/
+
+#include <cstring>
+#include "Exceptions.h"
+#include "LogEvent.h"
+
+using namespace std;
+
+
+namespace {
+    constexpr uint8_t ERROR_FLAG = 1;
+    constexpr uint8_t TIME_FLAG = 2;
+
+    constexpr size_t TYPE_OFFSET = 0;
+    constexpr size_t FLAGS_OFFSET = 1;
+    constexpr size_t ANGLE_OFFSET = 2;
+    constexpr size_t POINT_ID_OFFSET = 4;
+    constexpr size_t TIME_OFFSET = 8;
+    constexpr size_t DISTANCE_OFFSET = 16;
+    constexpr size_t X_OFFSET = 24;
+    constexpr size_t Y_OFFSET = 32;
+
+    template <typename T>
+    void writeField(char* record, const size_t& offset, const T& value) {
+        memcpy(record + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    T readField(const char* record, const size_t& offset) {
+        T value;
+        memcpy(&value, record + offset, sizeof(T));
+        return value;
+    }
+
+    u_int64_t remainingLength(istream& input) {
+        // Number of bytes left in the input, maximal value when the input cannot be searched
+
+        istream::pos_type position = input.tellg();
+        if (position == istream::pos_type(-1)) {
+            return UINT64_MAX;
+        }
+        input.seekg(0, ios::end);
+        istream::pos_type end = input.tellg();
+        input.clear();
+        input.seekg(position);
+        if (end == istream::pos_type(-1)) {
+            return UINT64_MAX;
+        }
+        return static_cast<u_int64_t>(end - position);
+    }
+
+    void writeHeader(char* record, const LogEventType& type, const bool& has_time, const bool& is_error) {
+        memset(record, 0, LogEvent::RECORD_SIZE);
+        writeField(record, TYPE_OFFSET, static_cast<uint8_t>(type));
+        writeField(record, FLAGS_OFFSET, static_cast<uint8_t>((is_error ? ERROR_FLAG : 0) | (has_time ? TIME_FLAG : 0)));
+    }
+}
+
+
+LogEvent LogEvent::createMovement(const u_int64_t& time, const double& distance, const double& x, const double& y) {
+    LogEvent event;
+    event.type_ = LogEventType::MOVEMENT;
+    event.time_ = time;
+    event.distance_ = distance;
+    event.x_ = x;
+    event.y_ = y;
+    return event;
+}
+
+
+LogEvent LogEvent::createMoveOutsideLawn(const u_int64_t& time) {
+    LogEvent event;
+    event.type_ = LogEventType::MOVE_OUTSIDE_LAWN;
+    event.time_ = time;
+    return event;
+}
+
+
+LogEvent LogEvent::createRotation(const u_int64_t& time, const short& angle) {
+    LogEvent event;
+    event.type_ = LogEventType::ROTATION;
+    event.time_ = time;
+    event.angle_ = angle;
+    return event;
+}
+
+
+LogEvent LogEvent::createInvalidRotation(const u_int64_t& time) {
+    LogEvent event;
+    event.type_ = LogEventType::INVALID_ROTATION;
+    event.time_ = time;
+    return event;
+}
+
+
+LogEvent LogEvent::createMowingOption(const u_int64_t& time, const bool& is_mowing) {
+    LogEvent event;
+    event.type_ = is_mowing ? LogEventType::MOWING_ON : LogEventType::MOWING_OFF;
+    event.time_ = time;
+    return event;
+}
+
+
+LogEvent LogEvent::createMovementToPoint(const u_int64_t& time, const unsigned int& point_id) {
+    LogEvent event;
+    event.type_ = LogEventType::MOVEMENT_TO_POINT;
+    event.time_ = time;
+    event.point_id_ = point_id;
+    return event;
+}
+
+
+LogEvent LogEvent::createPointNotFound(const u_int64_t& time, const unsigned int& point_id) {
+    LogEvent event;
+    event.type_ = LogEventType::POINT_NOT_FOUND;
+    event.time_ = time;
+    event.point_id_ = point_id;
+    return event;
+}
+
+
+LogEvent LogEvent::createDistanceToPoint(const unsigned int& point_id, const double& distance) {
+    LogEvent event;
+    event.type_ = LogEventType::DISTANCE_TO_POINT;
+    event.has_time_ = false;
+    event.point_id_ = point_id;
+    event.distance_ = distance;
+    return event;
+}
+
+
+LogEvent LogEvent::createDistancePointNotFound(const unsigned int& point_id) {
+    LogEvent event;
+    event.type_ = LogEventType::DISTANCE_POINT_NOT_FOUND;
+    event.has_time_ = false;
+    event.point_id_ = point_id;
+    return event;
+}
+
+
+LogEvent LogEvent::createCurrentPosition(const double& x, const double& y) {
+    LogEvent event;
+    event.type_ = LogEventType::CURRENT_POSITION;
+    event.has_time_ = false;
+    event.x_ = x;
+    event.y_ = y;
+    return event;
+}
+
+
+bool LogEvent::isError() const {
+    return type_ == LogEventType::MOVE_OUTSIDE_LAWN || type_ == LogEventType::INVALID_ROTATION || 
+        type_ == LogEventType::POINT_NOT_FOUND || type_ == LogEventType::DISTANCE_POINT_NOT_FOUND;
+}
+
+
+string LogEvent::formatMessage() const {
+    // Format message in the same way as text logs are written
+
+    switch (type_) {
+        case LogEventType::MOVEMENT:
+            return "Distance moved: " + to_string(distance_) + "from point x: " + to_string(x_) + 
+                ", y: " + to_string(y_);
+        case LogEventType::MOVE_OUTSIDE_LAWN:
+            return "Attempted to move outside the lawn.";
+        case LogEventType::ROTATION:
+            return "Rotated: " + to_string(angle_) + " degrees.";
+        case LogEventType::INVALID_ROTATION:
+            return "Invalid angle. Rotation angle must be in [-360; 360] range.";
+        case LogEventType::MOWING_ON:
+            return "Mowing mode: on";
+        case LogEventType::MOWING_OFF:
+            return "Mowing mode: off";
+        case LogEventType::MOVEMENT_TO_POINT:
+            return "Moving to point with id:  " + to_string(point_id_);
+        case LogEventType::POINT_NOT_FOUND:
+            return "Unable to find point in the lawn. Incorrect point's id " + to_string(point_id_);
+        case LogEventType::DISTANCE_TO_POINT:
+            return "Distance to point " + to_string(point_id_) + ": " + to_string(distance_);
+        case LogEventType::DISTANCE_POINT_NOT_FOUND:
+            return "Error: Point " + to_string(point_id_) + " not found for GetDistanceToPoint.";
+        case LogEventType::CURRENT_POSITION:
+            return "Current position: (" + to_string(x_) + ", " + to_string(y_) + ")";
+        case LogEventType::TEXT:
+            break;
+    }
+    return "";
+}
+
+
+string LogEvent::formatLine() const {
+    return formatLine(time_, has_time_, formatMessage());
+}
+
+
+string LogEvent::formatLine(const u_int64_t& time, const bool& has_time, const string& message) {
+    if (!has_time) {
+        return message;
+    }
+    return "Time: " + to_string(time) + ": " + message;
+}
+
+
+void LogEvent::appendRecord(string& output) const {
+    // Append binary record of the event to the output
+
+    char record[RECORD_SIZE];
+    writeHeader(record, type_, has_time_, isError());
+    writeField(record, ANGLE_OFFSET, angle_);
+    writeField(record, POINT_ID_OFFSET, point_id_);
+    writeField(record, TIME_OFFSET, time_);
+    writeField(record, DISTANCE_OFFSET, distance_);
+    writeField(record, X_OFFSET, x_);
+    writeField(record, Y_OFFSET, y_);
+    output.append(record, RECORD_SIZE);
+}
+
+
+void LogEvent::appendTextRecord(string& output, const u_int64_t& time, const bool& has_time, 
+        const bool& is_error, const string& text) {
+    // Append TEXT record followed by the text
+
+    char record[RECORD_SIZE];
+    writeHeader(record, LogEventType::TEXT, has_time, is_error);
+    writeField(record, POINT_ID_OFFSET, static_cast<uint32_t>(text.size()));
+    writeField(record, TIME_OFFSET, time);
+    output.append(record, RECORD_SIZE);
+    output.append(text);
+}
+
+
+bool LogEvent::readRecord(istream& input, LogEvent& event, string& text) {
+    /* Read next record from the binary log. Text of TEXT records is stored in text.
+        Returns false at the end of input or when the record is incomplete. Throws CorruptLogRecordError when 
+        the type is unknown or the text length is longer than MAX_TEXT_LENGTH or the rest of the input */
+
+    char record[RECORD_SIZE];
+    if (!input.read(record, RECORD_SIZE)) {
+        return false;
+    }
+
+    uint8_t flags = readField<uint8_t>(record, FLAGS_OFFSET);
+    uint8_t type = readField<uint8_t>(record, TYPE_OFFSET);
+    if (type > static_cast<uint8_t>(LogEventType::CURRENT_POSITION)) {
+        throw CorruptLogRecordError("Corrupt record: unknown event type " + to_string(type));
+    }
+    event.type_ = static_cast<LogEventType>(type);
+    event.has_time_ = (flags & TIME_FLAG) != 0;
+    event.angle_ = readField<int16_t>(record, ANGLE_OFFSET);
+    event.point_id_ = readField<uint32_t>(record, POINT_ID_OFFSET);
+    event.time_ = readField<u_int64_t>(record, TIME_OFFSET);
+    event.distance_ = readField<double>(record, DISTANCE_OFFSET);
+    event.x_ = readField<double>(record, X_OFFSET);
+    event.y_ = readField<double>(record, Y_OFFSET);
+
+    text.clear();
+    if (event.type_ == LogEventType::TEXT) {
+        if (event.point_id_ > MAX_TEXT_LENGTH || event.point_id_ > remainingLength(input)) {
+            throw CorruptLogRecordError("Corrupt record: text length " + to_string(event.point_id_));
+        }
+        text.resize(event.point_id_);
+        if (!input.read(&text[0], static_cast<streamsize>(text.size()))) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+/*
+    Author: Maciej Cieslik
+
+    Implements LogFilter class.
+*/
+
+#include "LogFilter.h"
+
+using namespace std;
+
+
+LogFilter::LogFilter(const LogLevel& level) {
+    levels_.fill(level);
+}
+
+
+bool LogFilter::operator==(const LogFilter& other) const {
+    return levels_ == other.levels_;
+}
+
+
+bool LogFilter::operator!=(const LogFilter& other) const {
+    return !(*this == other);
+}
+
+
+LogFilter LogFilter::createErrorsOnly() {
+    // Filter used by production runs - only errors are logged
+
+    LogFilter filter(LogLevel::OFF);
+    filter.setLevel(LogCategory::ERRORS, LogLevel::INFO);
+    return filter;
+}
+
+
+const LogLevel& LogFilter::getLevel(const LogCategory& category) const {
+    return levels_[static_cast<size_t>(category)];
+}
+
+
+void LogFilter::setLevel(const LogCategory& category, const LogLevel& level) {
+    levels_[static_cast<size_t>(category)] = level;
+}
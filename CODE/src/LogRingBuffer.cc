@@ -0,0 +1,88 @@
+/* 
+    Author: Maciej Cieslik
+    
+    Implements LogRingBuffer class.
+*/
+
+#include <utility>
+#include "LogRingBuffer.h"
+
+using namespace std;
+
+
+LogRingBuffer::LogRingBuffer(const size_t& capacity) : enqueue_position_(0), dequeue_position_(0) {
+    size_t rounded_capacity = 2;
+    while (rounded_capacity < capacity) {
+        rounded_capacity *= 2;
+    }
+    mask_ = rounded_capacity - 1;
+
+    cells_ = make_unique<Cell[]>(rounded_capacity);
+    for (size_t i = 0; i < rounded_capacity; ++i) {
+        cells_[i].sequence_.store(i, memory_order_relaxed);
+    }
+}
+
+
+size_t LogRingBuffer::getCapacity() const {
+    return mask_ + 1;
+}
+
+
+size_t LogRingBuffer::getPushedNumber() const {
+    return enqueue_position_.load(memory_order_acquire);
+}
+
+
+size_t LogRingBuffer::getPoppedNumber() const {
+    return dequeue_position_.load(memory_order_acquire);
+}
+
+
+bool LogRingBuffer::tryPush(LogEntry& entry) {
+    /* Move entry to the queue. Returns false (and leaves entry untouched) when the queue is full.
+        Cell is free for position p when its sequence is equal to p, and contains entry when it is p + 1 */
+
+    size_t position = enqueue_position_.load(memory_order_relaxed);
+    Cell* cell = nullptr;
+
+    while (true) {
+        cell = &cells_[position & mask_];
+        size_t sequence = cell->sequence_.load(memory_order_acquire);
+        intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0) {
+            if (enqueue_position_.compare_exchange_weak(position, position + 1, memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (difference < 0) {
+            return false;
+        }
+        else {
+            position = enqueue_position_.load(memory_order_relaxed);
+        }
+    }
+
+    cell->entry_ = move(entry);
+    cell->sequence_.store(position + 1, memory_order_release);
+    return true;
+}
+
+
+bool LogRingBuffer::tryPop(LogEntry& entry) {
+    // Move the oldest entry out of the queue. Must be called only by one (consumer) thread
+
+    size_t position = dequeue_position_.load(memory_order_relaxed);
+    Cell& cell = cells_[position & mask_];
+    size_t sequence = cell.sequence_.load(memory_order_acquire);
+
+    if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1) < 0) {
+        return false;
+    }
+
+    entry = move(cell.entry_);
+    cell.sequence_.store(position + mask_ + 1, memory_order_release);
+    dequeue_position_.store(position + 1, memory_order_release);
+    return true;
+}
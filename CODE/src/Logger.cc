@@ -4,25 +4,25 @@
     Implements Logger class.
 */
 
-#include <queue>
+#include <utility>
 #include "Logger.h"
 
 using namespace std;
 
 
-Logger::Logger() : logs_(queue<Log>()) {}
+Logger::Logger() : logs_(vector<Log>()), drained_logs_(vector<Log>()) {}
 
 
-const queue<Log>& Logger::getLogs() const {
-    return std::move(logs_);
+const vector<Log>& Logger::getLogs() const {
+    return logs_;
 }
 
 
-void Logger::push(const Log& log) {
-    logs_.push(log);
+void Logger::push(Log&& log) {
+    logs_.push_back(move(log));
 }
 
 
 void Logger::clear() {
-    logs_ = queue<Log>();
+    logs_.clear();
 }
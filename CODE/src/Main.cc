@@ -21,6 +21,7 @@
 #include "Engine.h"
 #include "Visualizer.h"
 #include "MowerController.h"
+#include "Tracer.h"
 
 using namespace std;
 
@@ -33,6 +34,9 @@ using namespace std;
     constexpr unsigned int BLADE_DIAMETER_CM = 50;
     constexpr unsigned int MOWER_SPEED_CM_S = 100;
     constexpr const char*  LOG_PATH = "../simulation_logs.log";
+    constexpr const char*  METRICS_PATH = "../simulation_metrics.txt";
+    constexpr double       METRICS_DUMP_INTERVAL_S = 1.0;
+    constexpr const char*  TRACE_PATH = "../simulation_trace.json"; // saved only when built with MOWER_TRACING
     constexpr int          TARGET_FPS = 100;
     constexpr int          RENDER_INTERVAL_MS = 1000 / TARGET_FPS;
 
@@ -84,6 +88,7 @@ void customUserLogic(MowerController& controller) {
 
 int main(int argc, char *argv[]) {
     QApplication app(argc, argv);
+    TRACE_THREAD_NAME("gui");
     cout << "[Main] Initializing components..." << endl;
     
     cout << "[Main] Creating lawn: " << LAWN_WIDTH_CM << "x" << LAWN_LENGTH_CM << " cm" << endl;
@@ -105,14 +110,16 @@ int main(int argc, char *argv[]) {
 
     cout << "[Main] Initializing Engine" << endl;
     Engine engine(simulation, 
-        [&controller](StateSimulation& sim, double dt) {
-            controller.update(sim, dt);
-        }, 
+        nullptr, 
         [&app](const string& error) {
             QMetaObject::invokeMethod(&app, "quit", Qt::QueuedConnection);
         }
     ); 
+    engine.setEventDrivenSimulationLogic([&controller](StateSimulation& sim, double dt, u_int64_t end_time) {
+        return controller.updateUntil(sim, dt, end_time);
+    });
     engine.setSimulationSpeed(SIMULATION_SPEED_MULTIPLIER);
+    engine.setMetricsDump(METRICS_PATH, METRICS_DUMP_INTERVAL_S);
     
     cout << "[Main] Creating window" << endl;
     Visualizer visualizer(engine.getStateInterpolator()); 
@@ -129,5 +136,26 @@ int main(int argc, char *argv[]) {
     
     cout << "[Main] Stopping simulation" << endl;
     engine.stop();
+
+    const LatencyHistogram& tick_duration = *engine.getMetrics().findHistogram("tick_duration_ns");
+    cout << "[Main] Tick duration p50/p99/max: " << tick_duration.getPercentile(50.0) << "/" 
+        << tick_duration.getPercentile(99.0) << "/" << tick_duration.getMax() << " ns (all metrics in " 
+        << METRICS_PATH << ")" << endl;
+    const StateInterpolator& interpolator = engine.getStateInterpolator();
+    cout << "[Main] Snapshot publish latency p50/p99/max: " << interpolator.getPublishLatency().getPercentile(50.0) 
+        << "/" << interpolator.getPublishLatency().getPercentile(99.0) << "/" << interpolator.getPublishLatency().getMax() 
+        << " ns" << endl;
+    cout << "[Main] Snapshot read latency p50/p99/max: " << interpolator.getReadLatency().getPercentile(50.0) 
+        << "/" << interpolator.getReadLatency().getPercentile(99.0) << "/" << interpolator.getReadLatency().getMax() 
+        << " ns" << endl;
+
+#ifdef MOWER_TRACING
+    if (Tracer::getInstance().saveChromeTrace(TRACE_PATH)) {
+        cout << "[Main] Trace saved to " << TRACE_PATH << " (" << Tracer::getInstance().getEventsNumber() 
+            << " events)" << endl;
+    } else {
+        cerr << "[Main] Unable to save trace to " << TRACE_PATH << endl;
+    }
+#endif
     return result;
 }
@@ -10,6 +10,11 @@
 
 using namespace std;
 
+static_assert(TrigonometryTables::SIN[0] == 0.0 && TrigonometryTables::SIN[90] == 1.0 && 
+    TrigonometryTables::SIN[180] == 0.0 && TrigonometryTables::SIN[270] == -1.0, "Exact sine of right angles");
+static_assert(TrigonometryTables::COS[0] == 1.0 && TrigonometryTables::COS[90] == 0.0 && 
+    TrigonometryTables::COS[180] == -1.0 && TrigonometryTables::COS[270] == 0.0, "Exact cosine of right angles");
+
 
 double MathHelper::convertDegreesToRadians(const unsigned short& angle) {
     double RADIAN_FACTOR = 180.0;
@@ -25,21 +30,6 @@ double MathHelper::convertRadiansToDegrees(const double& angle) {
 }
 
 
-double MathHelper::calculateAParameter(const unsigned short& angle) {
-    // Calculate 'a' parameter for linear function
-
-    double angle_in_radians = MathHelper::convertDegreesToRadians(angle);
-    return 1.0 / tan(angle_in_radians);
-}
-
-
-double MathHelper::calculateAPerpendicularParameter(const double& a_parameter) {
-    // Calculate 'a' parameter for linear function, which is perepndciular to function with 'a' parameter given
-
-    return -1.0 / a_parameter;
-}
-
-
 double MathHelper::roundNumber(const double& value, const double& precision) {
     return round(value * precision) / precision;
 }
@@ -0,0 +1,92 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of MetricsRegistry.
+*/
+
+#include <cstdio>
+#include <fstream>
+#include "MetricsRegistry.h"
+
+using namespace std;
+
+
+// Returns the counter with the given name, creating it on the first call
+MetricCounter& MetricsRegistry::addCounter(const string& name) {
+    lock_guard<mutex> lock(metrics_mutex_);
+    unique_ptr<MetricCounter>& counter = counters_[name];
+    if (!counter) {
+        counter = make_unique<MetricCounter>();
+    }
+    return *counter;
+}
+
+
+// Returns the histogram with the given name, creating it on the first call
+LatencyHistogram& MetricsRegistry::addHistogram(const string& name) {
+    lock_guard<mutex> lock(metrics_mutex_);
+    unique_ptr<LatencyHistogram>& histogram = histograms_[name];
+    if (!histogram) {
+        histogram = make_unique<LatencyHistogram>();
+    }
+    return *histogram;
+}
+
+
+const MetricCounter* MetricsRegistry::findCounter(const string& name) const {
+    lock_guard<mutex> lock(metrics_mutex_);
+    auto counter = counters_.find(name);
+    return counter != counters_.end() ? counter->second.get() : nullptr;
+}
+
+
+const LatencyHistogram* MetricsRegistry::findHistogram(const string& name) const {
+    lock_guard<mutex> lock(metrics_mutex_);
+    auto histogram = histograms_.find(name);
+    return histogram != histograms_.end() ? histogram->second.get() : nullptr;
+}
+
+
+void MetricsRegistry::reset() {
+    lock_guard<mutex> lock(metrics_mutex_);
+    for (auto& counter : counters_) {
+        counter.second->set(0);
+    }
+    for (auto& histogram : histograms_) {
+        histogram.second->reset();
+    }
+}
+
+
+// Writes counters as "<name> <value>" and histograms as "<name> count=... mean=... p50=... p99=... max=...",
+// sorted by name. Metrics can be updated by other threads while they are written.
+void MetricsRegistry::writeMetrics(ostream& output) const {
+    lock_guard<mutex> lock(metrics_mutex_);
+    for (const auto& counter : counters_) {
+        output << counter.first << ' ' << counter.second->get() << '\n';
+    }
+    for (const auto& histogram : histograms_) {
+        const LatencyHistogram& values = *histogram.second;
+        output << histogram.first << " count=" << values.getCount() << " mean=" << values.getMean()
+            << " p50=" << values.getPercentile(50.0) << " p99=" << values.getPercentile(99.0)
+            << " max=" << values.getMax() << '\n';
+    }
+}
+
+
+// Metrics are written to a temporary file, which then replaces the old one,
+// so a reader never sees a partially written file
+bool MetricsRegistry::saveMetrics(const string& path) const {
+    const string temporary_path = path + ".tmp";
+    {
+        ofstream output(temporary_path, ios::trunc);
+        if (!output) {
+            return false;
+        }
+        writeMetrics(output);
+        if (!output) {
+            return false;
+        }
+    }
+    return rename(temporary_path.c_str(), path.c_str()) == 0;
+}
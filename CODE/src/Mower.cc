@@ -6,7 +6,6 @@
 
 #include <cmath>
 #include "Constants.h"
-#include "Config.h"
 #include "Lawn.h"
 #include "Mower.h"
 #include "MathHelper.h"
@@ -17,8 +16,10 @@ using namespace std;
 
 
 Mower::Mower(const unsigned int& width, const unsigned int& length, const unsigned int& blade_diameter,
-        const unsigned int& speed) : width_(width), length_(length), blade_diameter_(blade_diameter), speed_(speed), 
-        angle_(Config::STARTING_ANGLE), is_mowing_(true), x_(Config::STARTING_X), y_(Config::STARTING_Y) {}
+        const unsigned int& speed, const double& starting_x, const double& starting_y, 
+        const unsigned short& starting_angle) : width_(width), length_(length), blade_diameter_(blade_diameter), 
+        speed_(speed), angle_(starting_angle), heading_x_(MathHelper::getSin(starting_angle)), 
+        heading_y_(MathHelper::getCos(starting_angle)), is_mowing_(true), x_(starting_x), y_(starting_y) {}
 
 
 bool Mower::operator==(const Mower& other) const {
@@ -60,6 +61,16 @@ unsigned short Mower::getAngle() const {
 }
 
 
+double Mower::getHeadingX() const {
+    return heading_x_;
+}
+
+
+double Mower::getHeadingY() const {
+    return heading_y_;
+}
+
+
 bool Mower::getIsMowing() const {
     return is_mowing_;
 }
@@ -77,6 +88,8 @@ double Mower::getY() const {
 
 void Mower::setAngle(const unsigned short& newAngle) {
     angle_ = newAngle;
+    heading_x_ = MathHelper::getSin(newAngle);
+    heading_y_ = MathHelper::getCos(newAngle);
 }
 
 
@@ -111,9 +124,8 @@ pair<double, double> Mower::calculateFinalPoint(const double& distance) const {
     // Calculate final point for mower movement
 
     double ROUND_MULTIPLIER = 1 / Constants::DISTANCE_PRECISION;
-    const double ANGLE_IN_RADIANS = MathHelper::convertDegreesToRadians(getAngle());
-    double calculated_x = getX() + sin(ANGLE_IN_RADIANS) * distance;
-    double calculated_y = getY() + cos(ANGLE_IN_RADIANS) * distance;
+    double calculated_x = getX() + heading_x_ * distance;
+    double calculated_y = getY() + heading_y_ * distance;
     double rounded_x = MathHelper::roundNumber(calculated_x, ROUND_MULTIPLIER);
     double rounded_y = MathHelper::roundNumber(calculated_y, ROUND_MULTIPLIER);
     
@@ -124,16 +136,16 @@ pair<double, double> Mower::calculateFinalPoint(const double& distance) const {
 bool Mower::calculateIfXAccessible(const double& calculated_x, const unsigned int& lawn_width) const {
     // Calculate if X coord is accessible for mower
 
-    return (calculated_x <= static_cast<double>(lawn_width) + Config::MAX_HORIZONTAL_EXCEEDANCE &&
-        calculated_x >= -Config::MAX_HORIZONTAL_EXCEEDANCE);
+    return (calculated_x <= static_cast<double>(lawn_width) + Constants::MAX_HORIZONTAL_EXCEEDANCE &&
+        calculated_x >= -Constants::MAX_HORIZONTAL_EXCEEDANCE);
 }
 
 
 bool Mower::calculateIfYAccessible(const double& calculated_y, const unsigned int& lawn_length) const {
     // Calculate if X coord is accessible for mower 
 
-    return (calculated_y <= static_cast<double>(lawn_length) + Config::MAX_VERTICAL_EXCEEDANCE &&
-        calculated_y >= -Config::MAX_VERTICAL_EXCEEDANCE);
+    return (calculated_y <= static_cast<double>(lawn_length) + Constants::MAX_VERTICAL_EXCEEDANCE &&
+        calculated_y >= -Constants::MAX_VERTICAL_EXCEEDANCE);
 }
 
 
@@ -4,11 +4,13 @@
 */
 
 #include "MowerController.h"
+#include "Tracer.h"
 
 // Executes the front command in the queue. Commands run over multiple frames
 // until they return true (finished). Only then does the queue move to the next command.
 // This ensures commands execute in order without overlapping.
 void MowerController::update(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("MowerController::update");
     if (command_queue_.empty()) {
         return;
     }
@@ -18,6 +20,32 @@ void MowerController::update(StateSimulation& sim, double dt) {
     }
 }
 
+// Event-driven variant of update: commands are executed one after another until the next event - the end
+// of a command, which moved the simulation time - or until the simulation time reaches the end time (ms).
+// Every command runs in steps of dt, moves are resolved at once instead of step by step, so a long
+// straight move costs a single call. Instantaneous commands are executed on the way. A command, which
+// neither finished nor moved the simulation time, is continued in the next call. Returns the time reached.
+u_int64_t MowerController::updateUntil(StateSimulation& sim, double dt, u_int64_t end_time) {
+    TRACE_SCOPE("MowerController::updateUntil");
+    const u_int64_t start_time = sim.getTime();
+    while (!command_queue_.empty() && sim.getTime() < end_time) {
+        u_int64_t time = sim.getTime();
+        if (command_queue_.front()->executeUntil(sim, dt, end_time)) {
+            command_queue_.pop();
+            if (sim.getTime() > start_time) {
+                break;
+            }
+        } else if (sim.getTime() == time) {
+            break;
+        }
+    }
+    return sim.getTime();
+}
+
+bool MowerController::hasPendingCommands() const {
+    return !command_queue_.empty();
+}
+
 void MowerController::move(double cm) {
     command_queue_.push(std::make_unique<MoveCommand>(cm));
 }
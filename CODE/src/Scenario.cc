@@ -0,0 +1,251 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of Scenario and ScenarioParser.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include "Scenario.h"
+#include "MowerController.h"
+#include "Exceptions.h"
+
+using namespace std;
+
+namespace {
+    constexpr char COMMENT_SIGN = '#';
+    constexpr unsigned int MAX_REPEAT_COUNT = 1000000;
+    constexpr double MAX_UNSIGNED = numeric_limits<unsigned int>::max();
+    constexpr double MAX_STARTING_ANGLE = 359;
+    constexpr double MAX_ROTATION = 360;
+    constexpr double MAX_SIMULATION_TIME = numeric_limits<unsigned int>::max(); // s, keeps time in ms in u_int64_t
+
+    // Reads next line without comment. Returns false at the end of input.
+    bool readLine(istream& input, unsigned int& line_number, istringstream& line) {
+        string text;
+        if (!getline(input, text)) {
+            return false;
+        }
+        ++line_number;
+
+        size_t comment_position = text.find(COMMENT_SIGN);
+        if (comment_position != string::npos) {
+            text.erase(comment_position);
+        }
+        line.clear();
+        line.str(text);
+        return true;
+    }
+
+    const vector<pair<string, LogCategory>> LOG_CATEGORIES = {
+        {"motion", LogCategory::MOTION}, {"rotation", LogCategory::ROTATION}, 
+        {"points", LogCategory::POINTS}, {"errors", LogCategory::ERRORS}
+    };
+
+    const vector<pair<string, LogLevel>> LOG_LEVELS = {
+        {"info", LogLevel::INFO}, {"error", LogLevel::ERROR}, {"off", LogLevel::OFF}
+    };
+
+    // Sets level of the given category ("all" meaning every category) in the filter. 
+    // Returns false for unknown category or level.
+    bool setLogLevel(LogFilter& filter, const string& category_name, const string& level_name) {
+        auto level = find_if(LOG_LEVELS.begin(), LOG_LEVELS.end(), 
+            [&level_name](const pair<string, LogLevel>& entry) { return entry.first == level_name; });
+        if (level == LOG_LEVELS.end()) {
+            return false;
+        }
+
+        bool is_found = false;
+        for (const pair<string, LogCategory>& category : LOG_CATEGORIES) {
+            if (category_name == "all" || category.first == category_name) {
+                filter.setLevel(category.second, level->second);
+                is_found = true;
+            }
+        }
+        return is_found;
+    }
+}
+
+// Queues all commands of the scenario in the controller, in the same order as in the script.
+void Scenario::addCommandsTo(MowerController& controller) const {
+    for (const ScenarioCommand& command : commands_) {
+        const vector<double>& args = command.arguments_;
+
+        if (command.name_ == "move") {
+            controller.move(args[0]);
+        } else if (command.name_ == "rotate") {
+            controller.rotate(static_cast<short>(args[0]));
+        } else if (command.name_ == "mowing") {
+            controller.setMowing(args[0] != 0.0);
+        } else if (command.name_ == "add_point") {
+            controller.addPoint(args[0], args[1]);
+        } else if (command.name_ == "delete_point") {
+            controller.deletePoint(static_cast<unsigned int>(args[0]));
+        } else if (command.name_ == "move_to_point") {
+            controller.moveToPoint(static_cast<unsigned int>(args[0]));
+        } else if (command.name_ == "rotate_towards_point") {
+            controller.rotateTowardsPoint(static_cast<unsigned int>(args[0]));
+        }
+    }
+}
+
+Scenario ScenarioParser::parseFile(const string& path) {
+    ifstream file(path);
+    if (!file.is_open()) {
+        throw ScenarioParseError("Cannot open scenario file: " + path);
+    }
+    return parse(file, path);
+}
+
+// Reads scenario header (lawn, mower, optional settings) and then the command script
+// after the 'commands' keyword. Lawn and mower are required.
+Scenario ScenarioParser::parse(istream& input, const string& name) {
+    Scenario scenario;
+    scenario.name_ = name;
+    unsigned int line_number = 0;
+    bool has_lawn = false;
+    bool has_mower = false;
+    istringstream line;
+
+    while (readLine(input, line_number, line)) {
+        string keyword;
+        if (!(line >> keyword)) {
+            continue;
+        }
+
+        if (keyword == "lawn") {
+            vector<double> args = parseArguments(line, name, line_number, keyword, 2, 0, MAX_UNSIGNED, true);
+            scenario.lawn_width_ = static_cast<unsigned int>(args[0]);
+            scenario.lawn_length_ = static_cast<unsigned int>(args[1]);
+            has_lawn = true;
+        } else if (keyword == "mower") {
+            vector<double> args = parseArguments(line, name, line_number, keyword, 4, 0, MAX_UNSIGNED, true);
+            scenario.mower_width_ = static_cast<unsigned int>(args[0]);
+            scenario.mower_length_ = static_cast<unsigned int>(args[1]);
+            scenario.blade_diameter_ = static_cast<unsigned int>(args[2]);
+            scenario.mower_speed_ = static_cast<unsigned int>(args[3]);
+            has_mower = true;
+        } else if (keyword == "start") {
+            vector<double> args = parseArguments(line, name, line_number, keyword, 2);
+            scenario.starting_x_ = args[0];
+            scenario.starting_y_ = args[1];
+            scenario.starting_angle_ = static_cast<unsigned short>(
+                parseArguments(line, name, line_number, keyword, 1, 0, MAX_STARTING_ANGLE, true)[0]);
+        } else if (keyword == "max_time") {
+            scenario.max_simulation_time_ = parseArguments(line, name, line_number, keyword, 1, 0, 
+                MAX_SIMULATION_TIME)[0];
+        } else if (keyword == "log") {
+            if (!(line >> scenario.log_path_)) {
+                throw ScenarioParseError(createErrorMessage(name, line_number, "missing log path"));
+            }
+            string format;
+            if (line >> format) {
+                if (format != "binary") {
+                    throw ScenarioParseError(createErrorMessage(name, line_number, "unknown log format '" + format + "'"));
+                }
+                scenario.log_format_ = LogFileFormat::BINARY;
+            }
+        } else if (keyword == "log_level") {
+            string category;
+            string level;
+            if (!(line >> category >> level) || !setLogLevel(scenario.log_filter_, category, level)) {
+                throw ScenarioParseError(createErrorMessage(name, line_number, "invalid log level"));
+            }
+        } else if (keyword == "commands") {
+            parseCommands(input, name, line_number, scenario.commands_, false);
+        } else {
+            throw ScenarioParseError(createErrorMessage(name, line_number, "unknown keyword '" + keyword + "'"));
+        }
+    }
+
+    if (!has_lawn || !has_mower) {
+        throw ScenarioParseError(createErrorMessage(name, line_number, "lawn and mower must be defined"));
+    }
+    return scenario;
+}
+
+// Parses commands until the end of input (or until 'end' of the current repeat block).
+// Repeat blocks are expanded, so the scenario keeps a flat list of commands.
+void ScenarioParser::parseCommands(istream& input, const string& name, unsigned int& line_number, 
+        vector<ScenarioCommand>& commands, const bool& is_inside_repeat) {
+    istringstream line;
+
+    while (readLine(input, line_number, line)) {
+        string keyword;
+        if (!(line >> keyword)) {
+            continue;
+        }
+
+        if (keyword == "end") {
+            if (!is_inside_repeat) {
+                throw ScenarioParseError(createErrorMessage(name, line_number, "'end' without 'repeat'"));
+            }
+            return;
+        } else if (keyword == "repeat") {
+            double count = parseArguments(line, name, line_number, keyword, 1, 0, MAX_REPEAT_COUNT, true)[0];
+            vector<ScenarioCommand> block;
+            parseCommands(input, name, line_number, block, true);
+            for (unsigned int i = 0; i < static_cast<unsigned int>(count); ++i) {
+                commands.insert(commands.end(), block.begin(), block.end());
+            }
+        } else if (keyword == "mowing") {
+            string option;
+            line >> option;
+            if (option != "on" && option != "off") {
+                throw ScenarioParseError(createErrorMessage(name, line_number, "mowing option must be on or off"));
+            }
+            commands.push_back(ScenarioCommand{keyword, {option == "on" ? 1.0 : 0.0}});
+        } else if (keyword == "move") {
+            commands.push_back(ScenarioCommand{keyword, parseArguments(line, name, line_number, keyword, 1)});
+        } else if (keyword == "rotate") {
+            commands.push_back(ScenarioCommand{keyword, 
+                parseArguments(line, name, line_number, keyword, 1, -MAX_ROTATION, MAX_ROTATION, true)});
+        } else if (keyword == "delete_point" || keyword == "move_to_point" || keyword == "rotate_towards_point") {
+            commands.push_back(ScenarioCommand{keyword, 
+                parseArguments(line, name, line_number, keyword, 1, 0, MAX_UNSIGNED, true)});
+        } else if (keyword == "add_point") {
+            commands.push_back(ScenarioCommand{keyword, parseArguments(line, name, line_number, keyword, 2)});
+        } else {
+            throw ScenarioParseError(createErrorMessage(name, line_number, "unknown command '" + keyword + "'"));
+        }
+    }
+
+    if (is_inside_repeat) {
+        throw ScenarioParseError(createErrorMessage(name, line_number, "'repeat' without 'end'"));
+    }
+}
+
+// Reads the given number of arguments and checks their range, so they can be safely converted to the
+// (often unsigned) types used by the simulation.
+vector<double> ScenarioParser::parseArguments(istream& line, const string& name, const unsigned int& line_number, 
+        const string& keyword, const size_t& arguments_number, const double& min_value, const double& max_value,
+        const bool& is_integer) {
+    vector<double> arguments(arguments_number);
+
+    for (double& argument : arguments) {
+        if (!(line >> argument) || !isfinite(argument)) {
+            throw ScenarioParseError(createErrorMessage(name, line_number, 
+                "'" + keyword + "' expects " + to_string(arguments_number) + " numeric arguments"));
+        }
+        if (argument < min_value || argument > max_value) {
+            ostringstream message;
+            message << "'" << keyword << "' argument " << argument << " is out of range " 
+                << fixed << setprecision(0) << "[" << min_value << ", " << max_value << "]";
+            throw ScenarioParseError(createErrorMessage(name, line_number, message.str()));
+        }
+        if (is_integer && argument != floor(argument)) {
+            throw ScenarioParseError(createErrorMessage(name, line_number, 
+                "'" + keyword + "' expects integer arguments"));
+        }
+    }
+    return arguments;
+}
+
+string ScenarioParser::createErrorMessage(const string& name, const unsigned int& line_number, 
+        const string& message) {
+    return name + ":" + to_string(line_number) + ": " + message;
+}
@@ -0,0 +1,85 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of SnapshotChannel.
+*/
+
+#include <utility>
+#include "SnapshotChannel.h"
+
+using namespace std;
+
+
+SnapshotChannel::SnapshotChannel(const size_t& capacity) : write_position_(0), read_position_(0), 
+    replaced_number_(0) {
+    size_t rounded_capacity = 2;
+    while (rounded_capacity < capacity) {
+        rounded_capacity *= 2;
+    }
+    mask_ = rounded_capacity - 1;
+    slots_ = make_unique<SimulationSnapshot[]>(rounded_capacity);
+}
+
+
+size_t SnapshotChannel::getCapacity() const {
+    return mask_ + 1;
+}
+
+
+// Number of snapshots, which were replaced by a newer one while the ring was full.
+size_t SnapshotChannel::getReplacedNumber() const {
+    return replaced_number_.load(memory_order_relaxed);
+}
+
+
+// Called by the producer. Publishes the snapshot waiting from the previous push first, to keep the order.
+void SnapshotChannel::push(SimulationSnapshot&& snapshot) {
+    if (has_pending_snapshot_) {
+        if (!tryPublish(pending_snapshot_)) {
+            pending_snapshot_ = move(snapshot);
+            replaced_number_.fetch_add(1, memory_order_relaxed);
+            return;
+        }
+        has_pending_snapshot_ = false;
+    }
+
+    if (!tryPublish(snapshot)) {
+        pending_snapshot_ = move(snapshot);
+        has_pending_snapshot_ = true;
+    }
+}
+
+
+// Called by the producer. Publishes the snapshot kept aside, if the ring has space again.
+// Returns false while the snapshot is still waiting.
+bool SnapshotChannel::flush() {
+    if (has_pending_snapshot_ && tryPublish(pending_snapshot_)) {
+        has_pending_snapshot_ = false;
+    }
+    return !has_pending_snapshot_;
+}
+
+
+bool SnapshotChannel::tryPublish(SimulationSnapshot& snapshot) {
+    size_t position = write_position_.load(memory_order_relaxed);
+    if (position - read_position_.load(memory_order_acquire) > mask_) {
+        return false;
+    }
+
+    slots_[position & mask_] = move(snapshot);
+    write_position_.store(position + 1, memory_order_release);
+    return true;
+}
+
+
+// Called by the consumer. Returns false when there is no new snapshot.
+bool SnapshotChannel::tryPop(SimulationSnapshot& snapshot) {
+    size_t position = read_position_.load(memory_order_relaxed);
+    if (position == write_position_.load(memory_order_acquire)) {
+        return false;
+    }
+
+    snapshot = move(slots_[position & mask_]);
+    read_position_.store(position + 1, memory_order_release);
+    return true;
+}
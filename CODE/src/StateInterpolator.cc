@@ -4,65 +4,134 @@
 */
 
 #include <algorithm> 
+#include <chrono>
 #include <cmath>     
 #include <iterator>  
+#include <utility>
 #include "StateInterpolator.h"
+#include "Tracer.h"
 
 using namespace std;
 
+namespace {
+    uint64_t measureNanoseconds(const chrono::steady_clock::time_point& start_time) {
+        return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now() - start_time).count());
+    }
+}
+
+
+StateInterpolator::StateInterpolator() : snapshot_channel_(CHANNEL_CAPACITY) {}
+
+// Publishes a new snapshot for the GUI thread. Called only by the simulation thread, never blocks.
+void StateInterpolator::addSimulationSnapshot( const SimulationSnapshot& sim_snapshot ){
+    addSimulationSnapshot( SimulationSnapshot( sim_snapshot ) );
+}
+
+void StateInterpolator::addSimulationSnapshot( SimulationSnapshot&& sim_snapshot ){
+    TRACE_SCOPE("StateInterpolator::addSimulationSnapshot");
+    auto start_time = chrono::steady_clock::now();
+
+    snapshot_channel_.push( move( sim_snapshot ) );
+
+    publish_latency_.record( measureNanoseconds( start_time ) );
+}
 
-// Adds a new snapshot to the buffer. Thread-safe with mutex lock.
+// Publishes the snapshot, which did not fit into the channel, once the GUI thread makes space.
+// Called only by the simulation thread (or after it finished). Returns false while it is still waiting.
+bool StateInterpolator::flushSimulationSnapshots(){
+    return snapshot_channel_.flush();
+}
+
+// Moves snapshots published by the simulation thread to the history buffer. Called only by the GUI thread.
 // If a snapshot with the same timestamp already exists, it updates that one instead.
 // (Some actions, like removing point or turning mowing on/off happen instantaneously and do not move the simulation time forward)
 // Rejects snapshots that are older than the newest one to keep time moving forward.
-void StateInterpolator::addSimulationSnapshot( const SimulationSnapshot& sim_snapshot ){
-    lock_guard<mutex> lock( mutex_ );
-    
-    if (tryUpdateExistingSnapshot(sim_snapshot)) {
-        return;
-    }
+void StateInterpolator::collectSnapshots() const {
+    SimulationSnapshot snapshot;
 
-    if( isSnapshotOutdated( sim_snapshot ) ){
-        return;
+    while( snapshot_channel_.tryPop( snapshot ) ){
+        if( tryUpdateExistingSnapshot( snapshot ) ){
+            continue;
+        }
+
+        if( isSnapshotOutdated( snapshot ) ){
+            continue;
+        }
+
+        storeSnapshot( move( snapshot ) );
+        enforceBufferSizeLimit();
     }
-    
-    storeSnapshot( sim_snapshot );
-    enforceBufferSizeLimit();
 }
 
-bool StateInterpolator::tryUpdateExistingSnapshot(const SimulationSnapshot& snapshot) {
+bool StateInterpolator::tryUpdateExistingSnapshot( SimulationSnapshot& snapshot ) const {
     if (sim_snapshot_buffer_.empty()) {
         return false;
     }
 
-    if (snapshot.simulation_time_ == sim_snapshot_buffer_.back().simulation_time_) {
-        sim_snapshot_buffer_.back() = snapshot;
+    if (snapshot.simulation_time_ == sim_snapshot_buffer_.back()->simulation_time_) {
+        sim_snapshot_buffer_.back() = make_shared<const SimulationSnapshot>(move(snapshot));
         return true;
     }
 
     return false;
 }
 
-// Returns a smoothly interpolated snapshot for the requested render time.
+// Returns a smoothly interpolated pose of the mower for the requested render time.
 // Interpolation means blending between two snapshots to create in-between positions.
 // This is what makes the mower move smoothly instead of jumping between snapshots.
-// Thread-safe with mutex lock.
-SimulationSnapshot StateInterpolator::getInterpolatedState( double render_time ) const {
-    lock_guard<mutex> lock( mutex_ );
-    
+// Called only by the GUI thread.
+InterpolatedPose StateInterpolator::getInterpolatedPose( double render_time ) const {
+    auto start_time = chrono::steady_clock::now();
+    collectSnapshots();
+
+    InterpolatedPose result;
     if( sim_snapshot_buffer_.empty() ){
-        return SimulationSnapshot();
+        result = InterpolatedPose();
+    }
+    else if( shouldReturnEarliestSnapshot( render_time ) ){
+        result = getPose( *sim_snapshot_buffer_.front() );
+    }
+    else if( shouldReturnLatestSnapshot( render_time ) ){
+        result = getPose( *sim_snapshot_buffer_.back() );
+    }
+    else {
+        result = computeInterpolatedPose( render_time );
     }
 
+    read_latency_.record( measureNanoseconds( start_time ) );
+    return result;
+}
+
+// Returns a read-only handle to the snapshot, whose lawn and points should be displayed at the render time
+// (the one the interpolation is heading to). Returns an empty handle if there are no snapshots yet.
+// Called only by the GUI thread.
+shared_ptr<const SimulationSnapshot> StateInterpolator::getSnapshotAt( double render_time ) const {
+    collectSnapshots();
+
+    if( sim_snapshot_buffer_.empty() ){
+        return nullptr;
+    }
     if( shouldReturnEarliestSnapshot( render_time ) ){
         return sim_snapshot_buffer_.front();
     }
-
     if( shouldReturnLatestSnapshot( render_time ) ){
         return sim_snapshot_buffer_.back();
     }
+    return *findFirstSnapshotAfter( render_time );
+}
 
-    return computeInterpolatedSnapshot( render_time );
+// Returns a full copy of the interpolated state. Prefer getInterpolatedPose and getSnapshotAt for rendering.
+SimulationSnapshot StateInterpolator::getInterpolatedState( double render_time ) const {
+    InterpolatedPose pose = getInterpolatedPose( render_time );
+    shared_ptr<const SimulationSnapshot> snapshot = getSnapshotAt( render_time );
+
+    SimulationSnapshot result = snapshot ? *snapshot : SimulationSnapshot();
+    result.x_ = pose.x_;
+    result.y_ = pose.y_;
+    result.angle_ = pose.angle_;
+    result.simulation_time_ = pose.simulation_time_;
+    return result;
 }
 
 void StateInterpolator::setStaticSimulationData(const StaticSimulationData& data) {
@@ -73,17 +142,25 @@ const StaticSimulationData& StateInterpolator::getStaticSimulationData() const {
     return static_simulation_data;
 }
 
+const LatencyHistogram& StateInterpolator::getPublishLatency() const {
+    return publish_latency_;
+}
+
+const LatencyHistogram& StateInterpolator::getReadLatency() const {
+    return read_latency_;
+}
+
 void StateInterpolator::setSimulationSpeedMultiplier( double speed ){
     current_speed_multiplier_.store( speed );
 }
 
-// Returns the timestamp of the most recent snapshot in the buffer.
+// Returns the timestamp of the most recent snapshot in the buffer. Called only by the GUI thread.
 double StateInterpolator::getSimulationTime() const {
-    lock_guard<mutex> lock( mutex_ );
+    collectSnapshots();
     if( sim_snapshot_buffer_.empty() ){
         return 0.0;
     }
-    return sim_snapshot_buffer_.back().simulation_time_;
+    return sim_snapshot_buffer_.back()->simulation_time_;
 }
 
 
@@ -95,17 +172,17 @@ bool StateInterpolator::isSnapshotOutdated( const SimulationSnapshot& snapshot )
     if( sim_snapshot_buffer_.empty() ){
         return false;
     }
-    return snapshot.simulation_time_ < sim_snapshot_buffer_.back().simulation_time_;
+    return snapshot.simulation_time_ < sim_snapshot_buffer_.back()->simulation_time_;
 }
 
 
-void StateInterpolator::storeSnapshot( const SimulationSnapshot& snapshot ){
-    sim_snapshot_buffer_.push_back( snapshot );
+void StateInterpolator::storeSnapshot( SimulationSnapshot&& snapshot ) const {
+    sim_snapshot_buffer_.push_back( make_shared<const SimulationSnapshot>( move( snapshot ) ) );
 }
 
 // Removes old snapshots from the front of the buffer to prevent unlimited memory growth.
 // Keeps only the most recent snapshots needed for interpolation.
-void StateInterpolator::enforceBufferSizeLimit(){
+void StateInterpolator::enforceBufferSizeLimit() const {
     while( sim_snapshot_buffer_.size() > MAX_BUFFER_SIZE ){
         sim_snapshot_buffer_.pop_front();
     }
@@ -114,25 +191,25 @@ void StateInterpolator::enforceBufferSizeLimit(){
 // Checks if the requested time is before or at the first snapshot.
 // In this case, return the earliest snapshot without interpolation.
 bool StateInterpolator::shouldReturnEarliestSnapshot( double render_time ) const {
-    return sim_snapshot_buffer_.size() == 1 || render_time <= sim_snapshot_buffer_.front().simulation_time_;
+    return sim_snapshot_buffer_.size() == 1 || render_time <= sim_snapshot_buffer_.front()->simulation_time_;
 }
 
 
 bool StateInterpolator::shouldReturnLatestSnapshot( double render_time ) const {
-    return render_time >= sim_snapshot_buffer_.back().simulation_time_;
+    return render_time >= sim_snapshot_buffer_.back()->simulation_time_;
 }
 
 // Creates a blended snapshot for the requested time by finding the two snapshots
 // that surround it and mixing them proportionally. Core interpolation logic.
-SimulationSnapshot StateInterpolator::computeInterpolatedSnapshot( double render_time ) const {
+InterpolatedPose StateInterpolator::computeInterpolatedPose( double render_time ) const {
     auto target_it = findFirstSnapshotAfter( render_time );
     
     if( target_it == sim_snapshot_buffer_.begin() ){
-        return sim_snapshot_buffer_.front();
+        return getPose( *sim_snapshot_buffer_.front() );
     }
 
-    const SimulationSnapshot& snapshot_after = *target_it;
-    const SimulationSnapshot& snapshot_before = *prev( target_it );
+    const SimulationSnapshot& snapshot_after = **target_it;
+    const SimulationSnapshot& snapshot_before = **prev( target_it );
 
     double alpha = calculateInterpolationAlpha( snapshot_before, snapshot_after, render_time );
 
@@ -140,10 +217,10 @@ SimulationSnapshot StateInterpolator::computeInterpolatedSnapshot( double render
 }
 
 
-deque<SimulationSnapshot>::const_iterator StateInterpolator::findFirstSnapshotAfter( double time ) const {
+deque<shared_ptr<const SimulationSnapshot>>::const_iterator StateInterpolator::findFirstSnapshotAfter( double time ) const {
     return lower_bound( sim_snapshot_buffer_.begin(), sim_snapshot_buffer_.end(), time,
-        []( const SimulationSnapshot& s, double t ){
-            return s.simulation_time_ < t;
+        []( const shared_ptr<const SimulationSnapshot>& s, double t ){
+            return s->simulation_time_ < t;
         });
 }
 
@@ -159,11 +236,10 @@ double StateInterpolator::calculateInterpolationAlpha( const SimulationSnapshot&
     return clamp( alpha, 0.0, 1.0 );
 }
 
-// Mixes two snapshots together based on the blend factor (alpha).
-// Creates a new snapshot with blended position and angle. The lawn state and points
-// are copied from the end snapshot (no blending needed for discrete data).
-SimulationSnapshot StateInterpolator::blendSnapshots( const SimulationSnapshot& start, const SimulationSnapshot& end, double alpha, double render_time ) const {
-    SimulationSnapshot result = end; 
+// Mixes poses of two snapshots together based on the blend factor (alpha).
+// The lawn state and points are not blended - they are read from the end snapshot (see getSnapshotAt).
+InterpolatedPose StateInterpolator::blendSnapshots( const SimulationSnapshot& start, const SimulationSnapshot& end, double alpha, double render_time ) const {
+    InterpolatedPose result;
     
     result.x_ = interpolate( start.x_, end.x_, alpha );
     result.y_ = interpolate( start.y_, end.y_, alpha );
@@ -173,6 +249,15 @@ SimulationSnapshot StateInterpolator::blendSnapshots( const SimulationSnapshot&
     return result;
 }
 
+InterpolatedPose StateInterpolator::getPose( const SimulationSnapshot& snapshot ) {
+    InterpolatedPose pose;
+    pose.x_ = snapshot.x_;
+    pose.y_ = snapshot.y_;
+    pose.angle_ = snapshot.angle_;
+    pose.simulation_time_ = snapshot.simulation_time_;
+    return pose;
+}
+
 // Basic linear interpolation formula: start + (end - start) * blend_factor.
 // When blend_factor is 0, returns start. When 1, returns end. In between, blends them.
 double StateInterpolator::interpolate( double a, double b, double alpha ){ 
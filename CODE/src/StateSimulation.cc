@@ -7,14 +7,17 @@
 
 #include <cmath>
 #include <iostream>
+#include <limits>
 #include <optional>
 #include "Constants.h"
 #include "StateSimulation.h"
 #include "Point.h"
 #include "Lawn.h"
 #include "Logger.h"
+#include "LogEvent.h"
 #include "MathHelper.h"
 #include "Exceptions.h"
+#include "Tracer.h"
 
 using namespace std;
 
@@ -73,135 +76,200 @@ const FileLogger& StateSimulation::getFileLogger() const {
 }
 
 
+const LogFilter& StateSimulation::getLogFilter() const {
+    return log_filter_;
+}
+
+
+void StateSimulation::setLogFilter(const LogFilter& log_filter) {
+    log_filter_ = log_filter;
+}
+
+
 void StateSimulation::simulateMovement(const double& distance) {
     /* Simulate movement of the mower. Handles situation when mower tries to go out of the lawn.
         Sends logs to file logger */
 
+    moveMower(distance, calculateMovementDuration(distance));
+}
+
+
+double StateSimulation::simulateMovementInSteps(const double& distance, const double& step, 
+        const u_int64_t& end_time) {
+    /* Simulate movement by the distance made in steps of the given length (as MoveCommand moves every tick),
+        but resolved at once: one move of the mower, one cut, one log and one time update. Simulation time is
+        the same as after the separate steps. Stops after the last step, which starts before the end time, 
+        and before the step, which would leave the lawn - that step is simulated on its own, so the error is
+        reported as in the stepped movement (or the step is made, when rounding keeps it inside the lawn).
+        At least one step is made. Returns distance moved */
+
+    if (distance <= 0.0 || step <= 0.0) {
+        return 0.0;
+    }
+
+    u_int64_t step_duration = calculateMovementDuration(step);
+    uint64_t steps_number = static_cast<uint64_t>(max(1.0, ceil((distance - Constants::DISTANCE_PRECISION) / step)));
+    if (end_time > time_ && step_duration > 0) {
+        steps_number = min(steps_number, (end_time - time_ - 1) / step_duration + 1);
+    } else {
+        steps_number = 1;
+    }
+
+    double steps_distance = min(distance, static_cast<double>(steps_number) * step);
+    double distance_inside_lawn = calculateDistanceInsideLawn();
+    if (steps_distance > distance_inside_lawn) {
+        uint64_t steps_inside_lawn = static_cast<uint64_t>(max(0.0, floor(distance_inside_lawn / step)));
+        double moved_distance = static_cast<double>(steps_inside_lawn) * step;
+        if (steps_inside_lawn > 0) {
+            moveMower(moved_distance, steps_inside_lawn * step_duration);
+        }
+        // Positions are rounded, so the step can still end inside the lawn
+        double last_step = min(step, distance - moved_distance);
+        simulateMovement(last_step);
+        return moved_distance + last_step;
+    }
+
+    // Every step but the last one is full, the last one is shorter when the distance ends there
+    u_int64_t duration = (steps_number - 1) * step_duration + 
+        calculateMovementDuration(steps_distance - static_cast<double>(steps_number - 1) * step);
+    moveMower(steps_distance, duration);
+    return steps_distance;
+}
+
+
+void StateSimulation::moveMower(const double& distance, const u_int64_t& duration) {
+    // Move the mower in a straight line, cut the grass on the way and advance time by the duration of the movement
+
     double begginning_x = mower_.getX();
     double begginning_y = mower_.getY();
-    short angle = mower_.getAngle();
-    double optional_distance = distance;
-    string message;
 
     try {
         mower_.move(distance, lawn_.getWidth(), lawn_.getLength());
-
-        message = "Distance moved: " + to_string(distance) + "from point x: " + to_string(begginning_x) + 
-            ", y: " + to_string(begginning_y);
     } catch (const MoveOutsideLawnError& e) {
-        Log log = Log(time_, "Attempted to move outside the lawn.");
-        logger_.push(log);
-        file_logger_.saveLog(log);
+        if (log_filter_.isEnabled(LogCategory::ERRORS, LogLevel::ERROR)) {
+            LogEvent event = LogEvent::createMoveOutsideLawn(time_);
+            logger_.push(Log(time_, event.formatMessage()));
+            file_logger_.saveEvent(event);
+        }
         throw; 
     }
 
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    if (log_filter_.isEnabled(LogCategory::MOTION, LogLevel::INFO)) {
+        file_logger_.saveEvent(LogEvent::createMovement(time_, distance, begginning_x, begginning_y));
+    }
 
-    calculateMovementTime(optional_distance);
+    time_ += duration;
 
     if (mower_.getIsMowing()) {
         pair<double, double> beginning_point = pair<double, double>(begginning_x, begginning_y);
         pair<double, double> ending_point = pair<double, double>(mower_.getX(), mower_.getY());
-        lawn_.cutGrassSection(beginning_point, mower_.getBladeDiameter(), ending_point, angle);
+        lawn_.cutGrassSection(beginning_point, mower_.getBladeDiameter(), ending_point);
     }
     
 }
 
 
-double StateSimulation::countDistanceToBorder(const double& distance) const {
-    // Count distance to the closest border of the lawn
-
-    double ROUND_MULTIPLIER = 1 / Constants::DISTANCE_PRECISION;
-    pair<double, double> borderCornerPoint = countBorderPoint();
-    double border_x = borderCornerPoint.first;
-    double border_y = borderCornerPoint.second;
+u_int64_t StateSimulation::calculateMovementDuration(const double& distance) const {
+    // Calculates duration of movement by the distance, rounded up to 10 ms
 
-    double angleInRadians = MathHelper::convertDegreesToRadians(mower_.getAngle());
+    double SECONDS_TO_MILISECONDS_MULTIPLIER = 1000;
 
-    // distances below mean how long distance has mower to move in given direction to reach border or it's extension  
-    double distance_to_vertical_border = (border_x - mower_.getX()) / sin(angleInRadians);
-    double distance_to_horizontal_border = (border_y - mower_.getY()) / cos(angleInRadians);
-    return min(MathHelper::roundNumber(distance_to_vertical_border, ROUND_MULTIPLIER), 
-        MathHelper::roundNumber(distance_to_horizontal_border, ROUND_MULTIPLIER));
+    double time_ms = distance * SECONDS_TO_MILISECONDS_MULTIPLIER / mower_.getSpeed();
+    return u_int64_t(ceil(time_ms / 10.0) * 10.0);
 }
 
 
-void StateSimulation::calculateMovementTime(const double& distance) {
-    // Calculates time of movement action
-
-    double SECONDS_TO_MILISECONDS_MULTIPLIER = 1000;
+double StateSimulation::calculateDistanceInsideLawn() const {
+    // Longest distance, which the mower can move in its direction without leaving the lawn
 
-    double time_ms = distance * SECONDS_TO_MILISECONDS_MULTIPLIER / mower_.getSpeed();
-    u_int64_t result_time = u_int64_t(ceil(time_ms / 10.0) * 10.0);
+    const double NEVER_REACHED = numeric_limits<double>::infinity();
+    double heading_x = mower_.getHeadingX();
+    double heading_y = mower_.getHeadingY();
+    double border_x = heading_x > 0.0 ? lawn_.getWidth() + Constants::MAX_HORIZONTAL_EXCEEDANCE : 
+        -Constants::MAX_HORIZONTAL_EXCEEDANCE;
+    double border_y = heading_y > 0.0 ? lawn_.getLength() + Constants::MAX_VERTICAL_EXCEEDANCE : 
+        -Constants::MAX_VERTICAL_EXCEEDANCE;
 
-    time_ += result_time;
+    double distance_to_vertical_border = heading_x != 0.0 ? (border_x - mower_.getX()) / heading_x : NEVER_REACHED;
+    double distance_to_horizontal_border = heading_y != 0.0 ? (border_y - mower_.getY()) / heading_y : NEVER_REACHED;
+    return min(distance_to_vertical_border, distance_to_horizontal_border);
 }
 
 
-pair<double, double> StateSimulation::countBorderPoint() const {
-    // Calculates coords of the point, in which mower must stop not to exeede teh lawn area
-
-    double border_x;
-    double border_y;
+void StateSimulation::simulateRotation(const short& angle) {
+    // Simulate rotation of the mower, which takes time needed to rotate by the angle
 
-    if (mower_.getAngle() < 90) {
-        border_x = lawn_.getWidth();
-        border_y = lawn_.getLength();
-    }
-    else if (mower_.getAngle() < 180) {
-        border_x = lawn_.getWidth();
-        border_y = 0;
-    }
-    else if (mower_.getAngle() < 270) {
-        border_x = 0;
-        border_y = 0;
-    }
-    else {
-        border_x = 0;
-        border_y = lawn_.getLength();
-    }
-    return pair<double, double>(border_x, border_y);
+    simulateRotation(angle, calculateRotationDuration(angle));
 }
 
 
-void StateSimulation::simulateRotation(const short& angle) {
-    /* Simulate rotation of the mower. Handles situation when mower wants to rotate incorrectly.
-        Sends logs to file logger */
+void StateSimulation::simulateRotation(const short& angle, const u_int64_t& duration) {
+    /* Simulate rotation of the mower lasting the given duration (e.g. of the separate steps, which it replaces). 
+        Handles situation when mower wants to rotate incorrectly. Sends logs to file logger */
 
     short beginning_angle = mower_.getAngle();
     u_int64_t time = time_;
-    string message;
 
     try {
         mower_.rotate(angle);
-
-        message = "Rotated: " + to_string(angle) + " degrees.";
         
-        calculateRotationTime(angle);
+        time_ += duration;
     }
     catch (const RotationAngleOutOfRangeError& e) {
-        message = "Invalid angle. Rotation angle must be in [-360; 360] range.";
+        if (log_filter_.isEnabled(LogCategory::ERRORS, LogLevel::ERROR)) {
+            LogEvent event = LogEvent::createInvalidRotation(time);
 
-        logger_.push(Log(time, message));
+            logger_.push(Log(time, event.formatMessage()));
+            file_logger_.saveEvent(event);
+        }
+        return;
     }
 
-    Log log = Log(time, message);
-    file_logger_.saveLog(log);
+    if (log_filter_.isEnabled(LogCategory::ROTATION, LogLevel::INFO)) {
+        file_logger_.saveEvent(LogEvent::createRotation(time, angle));
+    }
 }
 
 
-void StateSimulation::calculateRotationTime(const short& angle) { 
-    // Calculate time of the rotation action
+short StateSimulation::simulateRotationInSteps(const short& angle, const double& step, double& accumulator, 
+        const u_int64_t& end_time) {
+    /* Simulate rotation by the angle made in steps of at most the given number of degrees (as the point commands
+        rotate every tick), but resolved at once: one rotation, one log and one time update. Only whole degrees
+        are rotated, the rest of every step is kept in the accumulator, and every step takes as long as 
+        the separate rotation would, so simulation time is the same as after the separate steps. 
+        Stops after the last step, which starts before the end time. Returns angle rotated */
+
+    if (angle == 0 || step <= 0.0) {
+        return 0;
+    }
+
+    short rotation = 0;
+    u_int64_t duration = 0;
+    do {
+        double angle_left = static_cast<double>(angle - rotation);
+        accumulator += angle_left > 0 ? min(angle_left, step) : max(angle_left, -step);
+        short step_rotation = static_cast<short>(accumulator);
+        accumulator -= step_rotation;
+        rotation += step_rotation;
+        duration += calculateRotationDuration(step_rotation);
+    } while (rotation != angle && time_ + duration < end_time);
+
+    if (rotation != 0) {
+        simulateRotation(rotation, duration);
+    }
+    return rotation;
+}
+
+
+u_int64_t StateSimulation::calculateRotationDuration(const short& angle) const { 
+    // Calculate duration of the rotation action, rounded up to 10 ms
 
     short MAX_ROTATION_ANGLE = 360;
     double SECONDS_TO_MILISECONDS_MULTIPLIER = 1000;
     short positive_angle = (angle + MAX_ROTATION_ANGLE) % MAX_ROTATION_ANGLE;
 
     double time_ms = positive_angle * SECONDS_TO_MILISECONDS_MULTIPLIER / Constants::ROTATION_SPEED;
-    u_int64_t result_time = u_int64_t(ceil(time_ms / 10.0) * 10.0);
-
-    time_ += result_time;
+    return u_int64_t(ceil(time_ms / 10.0) * 10.0);
 }
 
 
@@ -210,9 +278,9 @@ void StateSimulation::simulateMowingOptionOn() {
 
     mower_.turnOnMowing();
 
-    string message = "Mowing mode: on";
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    if (log_filter_.isEnabled(LogCategory::MOTION, LogLevel::INFO)) {
+        file_logger_.saveEvent(LogEvent::createMowingOption(time_, true));
+    }
 }
 
 
@@ -221,38 +289,29 @@ void StateSimulation::simulateMowingOptionOff() {
 
     mower_.turnOffMowing();
 
-    string message = "Mowing mode: off";
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    if (log_filter_.isEnabled(LogCategory::MOTION, LogLevel::INFO)) {
+        file_logger_.saveEvent(LogEvent::createMowingOption(time_, false));
+    }
 }
 
 
 void StateSimulation::simulateAddPoint(const double& x, const double& y) {
     // Simulate adding point on the law
 
-    string message;
-
     if(lawn_.isPointInLawn(x, y)) {
         points_.push_back(Point(x, y, next_point_id_));
 
-        message = "Added point with id: " + to_string(next_point_id_) + "on coordinates x: " + to_string(x) + 
-            ", y: " + to_string(y);
-
         next_point_id_ ++;
     }
-    else {
-        message = "Unable to add point outside the lawn.";
-        logger_.push(Log(time_, message));
+    else if (log_filter_.isEnabled(LogCategory::ERRORS, LogLevel::ERROR)) {
+        logger_.push(Log(time_, "Unable to add point outside the lawn."));
     }
-
-    Log log = Log(time_, message);
 }
 
 void StateSimulation::simulateDeletePoint(const unsigned int& id) {
     // Simulates deleting point from the lawn
 
     bool is_found = false;
-    string message;
 
     for (auto iterator = points_.begin(); iterator != points_.end(); ) {
         if (iterator->getId() == id) {
@@ -263,15 +322,9 @@ void StateSimulation::simulateDeletePoint(const unsigned int& id) {
             ++iterator;
         }
     }
-    if (!is_found) {
-        message = "Unable to delete point from lawn. Incorrect point's id: " + to_string(id);
-        logger_.push(Log(time_, message));
-    }
-    else {
-        message = "Deleted point with id: " + to_string(id);
+    if (!is_found && log_filter_.isEnabled(LogCategory::ERRORS, LogLevel::ERROR)) {
+        logger_.push(Log(time_, "Unable to delete point from lawn. Incorrect point's id: " + to_string(id)));
     }
-
-    Log log = Log(time_, message);
 }
 
 
@@ -283,7 +336,6 @@ void StateSimulation::simulateMovementToPoint(const unsigned int& id) {
     bool is_found = false;
     double x;
     double y;
-    string message;
 
     for (const Point& point : points_) {
         if (point.getId() == id) {
@@ -294,11 +346,12 @@ void StateSimulation::simulateMovementToPoint(const unsigned int& id) {
         }
     }
     if (!is_found) {
-        message = "Unable to find point in the lawn. Incorrect point's id " + to_string(id);
-        Log log = Log(time_, message);
+        if (log_filter_.isEnabled(LogCategory::ERRORS, LogLevel::ERROR)) {
+            LogEvent event = LogEvent::createPointNotFound(time_, id);
 
-        logger_.push(log);
-        file_logger_.saveLog(log);
+            logger_.push(Log(time_, event.formatMessage()));
+            file_logger_.saveEvent(event);
+        }
         return;
     }
 
@@ -307,9 +360,9 @@ void StateSimulation::simulateMovementToPoint(const unsigned int& id) {
         moveToPointAttempt(x, y);
     }
 
-    message = "Moving to point with id:  " + to_string(id);
-    Log log = Log(time_, message);
-    file_logger_.saveLog(log);
+    if (log_filter_.isEnabled(LogCategory::POINTS, LogLevel::INFO)) {
+        file_logger_.saveEvent(LogEvent::createMovementToPoint(time_, id));
+    }
 }
 
 
@@ -379,13 +432,16 @@ double StateSimulation::calculateRotationDx(const double& dy, const double& dx)
 }
 
 SimulationSnapshot StateSimulation::buildSimulationSnapshot() const {
+    TRACE_SCOPE("StateSimulation::buildSimulationSnapshot");
     SimulationSnapshot sim_snapshot;
     sim_snapshot.x_ = mower_.getX();
     sim_snapshot.y_ = mower_.getY();
     sim_snapshot.angle_ = mower_.getAngle();
     sim_snapshot.simulation_time_ = static_cast<double>(time_);
 
-    sim_snapshot.fields_ = lawn_.getFields();
+    // Copies only tile pointers, tiles cut later are cloned by the lawn (copy-on-write)
+    sim_snapshot.lawn_grid_ = lawn_.getGrid();
+    sim_snapshot.lawn_generation_ = lawn_.getGeneration();
     sim_snapshot.points_ = points_;
 
     return sim_snapshot;
@@ -409,18 +465,19 @@ std::optional<std::pair<double, double>> StateSimulation::getPointCoordinates(un
         }
     }
     
-    string message = "Unable to find point in the lawn. Incorrect point's id " + to_string(pointId);
-    Log log = Log(time_, message);
-    logger_.push(log);
-    file_logger_.saveLog(log);
+    if (log_filter_.isEnabled(LogCategory::ERRORS, LogLevel::ERROR)) {
+        LogEvent event = LogEvent::createPointNotFound(time_, pointId);
+        logger_.push(Log(time_, event.formatMessage()));
+        file_logger_.saveEvent(event);
+    }
     
     return std::nullopt;
 }
 
 void StateSimulation::logArrivalAtPoint(unsigned int pointId) {
-    string message = "Arrived at point with id:  " + to_string(pointId);
-    Log log = Log(time_, message);
-    logger_.push(log);       
+    if (log_filter_.isEnabled(LogCategory::POINTS, LogLevel::INFO)) {
+        logger_.push(Log(time_, "Arrived at point with id:  " + to_string(pointId), false));
+    }
 }
 
 std::pair<short, double> StateSimulation::calculateNavigationVector(double targetX, double targetY) const {
@@ -0,0 +1,205 @@
+/*
+    Author: Hanna Biegacz
+
+    Implementation of Tracer and TraceBuffer.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include "Tracer.h"
+
+using namespace std;
+
+namespace {
+    constexpr uint32_t TRACE_PROCESS_ID = 1;
+    constexpr double NANOSECONDS_TO_MICROSECONDS = 0.001;
+    constexpr std::streamsize MICROSECONDS_PRECISION = 3; // full nanosecond resolution
+
+    uint64_t getClockNanoseconds() {
+        return static_cast<uint64_t>(chrono::duration_cast<chrono::nanoseconds>(
+            chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void writeJsonString(ostream& output, const string& text) {
+        output << '"';
+        for (char character : text) {
+            if (character == '"' || character == '\\') {
+                output << '\\' << character;
+            } else if (static_cast<unsigned char>(character) < 0x20) {
+                char escaped[8];
+                snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+                output << escaped;
+            } else {
+                output << character;
+            }
+        }
+        output << '"';
+    }
+}
+
+
+TraceBuffer::TraceBuffer(const uint32_t& thread_id)
+    : size_(0), dropped_number_(0), thread_id_(thread_id), thread_name_("thread " + to_string(thread_id)) {}
+
+
+// Called only by the owner thread. The release store of the size publishes the written event
+// (and the newly allocated chunk) to the threads reading the buffer.
+bool TraceBuffer::push(const TraceEvent& event) {
+    size_t index = size_.load(memory_order_relaxed);
+    if (index >= CAPACITY) {
+        dropped_number_.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+
+    size_t chunk = index / CHUNK_SIZE;
+    if (index % CHUNK_SIZE == 0) {
+        chunks_[chunk] = make_unique<TraceEvent[]>(CHUNK_SIZE);
+    }
+    chunks_[chunk][index % CHUNK_SIZE] = event;
+    size_.store(index + 1, memory_order_release);
+    return true;
+}
+
+
+size_t TraceBuffer::getSize() const {
+    return size_.load(memory_order_acquire);
+}
+
+
+// Index must be lower than the size read before
+const TraceEvent& TraceBuffer::getEvent(const size_t& index) const {
+    return chunks_[index / CHUNK_SIZE][index % CHUNK_SIZE];
+}
+
+
+uint64_t TraceBuffer::getDroppedNumber() const {
+    return dropped_number_.load(memory_order_relaxed);
+}
+
+
+const uint32_t& TraceBuffer::getThreadId() const {
+    return thread_id_;
+}
+
+
+const string& TraceBuffer::getThreadName() const {
+    return thread_name_;
+}
+
+
+void TraceBuffer::setThreadName(const string& thread_name) {
+    thread_name_ = thread_name;
+}
+
+
+Tracer::Tracer() : start_time_(getClockNanoseconds()) {}
+
+
+Tracer& Tracer::getInstance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+
+uint64_t Tracer::getTimestamp() const {
+    return getClockNanoseconds() - start_time_;
+}
+
+
+void Tracer::record(const char* name, const uint64_t& start, const uint64_t& end) {
+    getThreadBuffer().push({name, start, end > start ? end - start : 0});
+}
+
+
+// Thread names are read while saving the trace, so they are changed under the mutex
+void Tracer::setThreadName(const string& thread_name) {
+    TraceBuffer& buffer = getThreadBuffer();
+    lock_guard<mutex> lock(buffers_mutex_);
+    buffer.setThreadName(thread_name);
+}
+
+
+// The buffer of the thread is created on its first event. Later events use the cached pointer,
+// so the mutex is not taken on the hot path.
+TraceBuffer& Tracer::getThreadBuffer() {
+    thread_local TraceBuffer* thread_buffer = nullptr;
+    if (thread_buffer == nullptr) {
+        lock_guard<mutex> lock(buffers_mutex_);
+        buffers_.push_back(make_unique<TraceBuffer>(static_cast<uint32_t>(buffers_.size() + 1)));
+        thread_buffer = buffers_.back().get();
+    }
+    return *thread_buffer;
+}
+
+
+size_t Tracer::getEventsNumber() const {
+    lock_guard<mutex> lock(buffers_mutex_);
+    size_t events_number = 0;
+    for (const unique_ptr<TraceBuffer>& buffer : buffers_) {
+        events_number += buffer->getSize();
+    }
+    return events_number;
+}
+
+
+uint64_t Tracer::getDroppedNumber() const {
+    lock_guard<mutex> lock(buffers_mutex_);
+    uint64_t dropped_number = 0;
+    for (const unique_ptr<TraceBuffer>& buffer : buffers_) {
+        dropped_number += buffer->getDroppedNumber();
+    }
+    return dropped_number;
+}
+
+
+// Writes all events published so far as "complete" (ph X) events with microsecond timestamps,
+// preceded by the thread name metadata. Threads can keep tracing while the trace is written.
+void Tracer::writeChromeTrace(ostream& output) const {
+    lock_guard<mutex> lock(buffers_mutex_);
+    ios_base::fmtflags flags = output.flags();
+    streamsize precision = output.precision(MICROSECONDS_PRECISION);
+    output.setf(ios_base::fixed, ios_base::floatfield);
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    bool is_first = true;
+    auto separate = [&output, &is_first]() {
+        output << (is_first ? "\n" : ",\n");
+        is_first = false;
+    };
+
+    for (const unique_ptr<TraceBuffer>& buffer : buffers_) {
+        separate();
+        output << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << TRACE_PROCESS_ID << ",\"tid\":"
+            << buffer->getThreadId() << ",\"args\":{\"name\":";
+        writeJsonString(output, buffer->getThreadName());
+        output << "}}";
+    }
+
+    for (const unique_ptr<TraceBuffer>& buffer : buffers_) {
+        size_t size = buffer->getSize();
+        for (size_t i = 0; i < size; ++i) {
+            const TraceEvent& event = buffer->getEvent(i);
+            separate();
+            output << "{\"name\":";
+            writeJsonString(output, event.name_);
+            output << ",\"cat\":\"mower\",\"ph\":\"X\",\"ts\":" << event.start_ * NANOSECONDS_TO_MICROSECONDS
+                << ",\"dur\":" << event.duration_ * NANOSECONDS_TO_MICROSECONDS << ",\"pid\":" << TRACE_PROCESS_ID
+                << ",\"tid\":" << buffer->getThreadId() << "}";
+        }
+    }
+    output << "\n]}\n";
+
+    output.flags(flags);
+    output.precision(precision);
+}
+
+
+bool Tracer::saveChromeTrace(const string& path) const {
+    ofstream output(path);
+    if (!output) {
+        return false;
+    }
+    writeChromeTrace(output);
+    return static_cast<bool>(output);
+}
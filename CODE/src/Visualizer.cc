@@ -14,6 +14,7 @@
 #include "Lawn.h"
 #include "Mower.h"
 #include "MathHelper.h"
+#include "Tracer.h"
 
 
 using namespace std;
@@ -24,7 +25,8 @@ const QColor Visualizer::MOWED_GRASS_COLOR =   QColor(115, 213, 139);
 
 Visualizer::Visualizer(StateInterpolator& render_context, QWidget* parent)
     : QWidget(parent), state_interpolator_(render_context), render_time_controller_(render_context) { 
-    current_sim_snapshot_ = state_interpolator_.getInterpolatedState(0);
+    current_pose_ = state_interpolator_.getInterpolatedPose(0);
+    current_sim_snapshot_ = state_interpolator_.getSnapshotAt(0);
     static_simulation_data_ = state_interpolator_.getStaticSimulationData();
 
     setMinimumSize(MIN_WINDOW_WIDTH, MIN_WINDOW_HEIGHT);
@@ -106,15 +108,17 @@ QPointF Visualizer::mapToScreen(double x_cm, double y_cm) const{
 // Main rendering function called automatically by Qt every frame. Updates time,
 // fetches the current interpolated state, and draws the lawn, points, and mower.
 void Visualizer::paintEvent(QPaintEvent* event) {
+    TRACE_SCOPE("Visualizer::paintEvent");
     QPainter painter(this);
     setupPainter(painter);
     
     updateRenderTime();
     refreshStateAndLayout();
 
+    updateLawnImage();
     renderLawn(painter);
     renderPoints(painter);
-    renderMower(painter, current_sim_snapshot_);
+    renderMower(painter, current_pose_);
     
     update(); 
 }
@@ -139,11 +143,12 @@ void Visualizer::setupPainter(QPainter& painter) {
     painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
 }
 
-// Fetches the latest interpolated state for the current render time and
-// updates layout in case window size or simulation data changed.
+// Fetches the interpolated pose and a handle to the snapshot for the current render time and
+// updates layout in case window size or simulation data changed. Nothing but the pose is copied.
 void Visualizer::refreshStateAndLayout() {
     double render_time = render_time_controller_.getSmoothedTime();
-    current_sim_snapshot_ = state_interpolator_.getInterpolatedState(render_time);
+    current_pose_ = state_interpolator_.getInterpolatedPose(render_time);
+    current_sim_snapshot_ = state_interpolator_.getSnapshotAt(render_time);
     static_simulation_data_ = state_interpolator_.getStaticSimulationData();
     updateLayout();
 }
@@ -153,31 +158,64 @@ bool Visualizer::hasValidLawnDimensions() const {
 }
 
 bool Visualizer::isLawnDataEmpty() const {
-    const auto& fields = current_sim_snapshot_.fields_;
-    return fields.empty() || fields[0].empty();
+    return !current_sim_snapshot_ || current_sim_snapshot_->lawn_grid_.isEmpty();
 }
 
-// Draws the lawn by creating a QImage from the boolean grid (mowed vs unmowed).
-// Each cell in the simulation grid becomes one pixel in the image. The image is then
-// stretched to fit the screen using the calculated scale. Antialiasing is temporarily
-// disabled to keep grass cells sharp and prevent blending between mowed/unmowed areas.
-void Visualizer::renderLawn(QPainter& painter) const {
-    if (isLawnDataEmpty()) return;
+// Keeps the persistent lawn image in sync with the current snapshot. Each cell in the simulation
+// grid is one pixel of the image (rows flipped, so row 0 is at the bottom). Snapshots share unchanged
+// tiles with the previously rendered grid, so only tiles with a different pointer are redrawn and
+// the cost of a frame depends on what was mowed since the last frame, not on the lawn size.
+// Nothing is done when the snapshot did not change since the last frame.
+void Visualizer::updateLawnImage() {
+    if (isLawnDataEmpty() || current_sim_snapshot_ == rendered_sim_snapshot_) return;
+
+    const LawnGrid& grid = current_sim_snapshot_->lawn_grid_;
+    const int num_rows = static_cast<int>(grid.getRowsNumber());
+    const int num_cols = static_cast<int>(grid.getColumnsNumber());
+
+    if (lawn_image_.width() != num_cols || lawn_image_.height() != num_rows) {
+        lawn_image_ = QImage(num_cols, num_rows, QImage::Format_RGB32);
+        lawn_image_.fill(UNMOWED_GRASS_COLOR);
+        rendered_lawn_grid_ = LawnGrid(grid.getColumnsNumber(), grid.getRowsNumber());
+    }
 
-    const auto& fields = current_sim_snapshot_.fields_;
-    const int num_rows = static_cast<int>(fields.size());
-    const int num_cols = static_cast<int>(fields[0].size());
+    for (unsigned int tile_row = 0; tile_row < grid.getVerticalTilesNumber(); ++tile_row) {
+        for (unsigned int tile_col = 0; tile_col < grid.getHorizontalTilesNumber(); ++tile_col) {
+            if (!grid.hasSameTile(rendered_lawn_grid_, tile_col, tile_row)) {
+                updateLawnImageTile(grid, tile_col, tile_row);
+            }
+        }
+    }
 
-    QImage lawn_image(num_cols, num_rows, QImage::Format_RGB32);
-    
-    for (int row = 0; row < num_rows; ++row) {
-        int img_row = num_rows - 1 - row;
-        const auto& field_row = fields[row];
-        for (int col = 0; col < num_cols; ++col) {
-            lawn_image.setPixel(col, img_row, 
-                field_row[col] ? MOWED_GRASS_COLOR.rgb() : UNMOWED_GRASS_COLOR.rgb());
+    rendered_lawn_grid_ = grid;
+    rendered_sim_snapshot_ = current_sim_snapshot_;
+}
+
+// Rewrites pixels of a single tile directly through scanLine, one 64-bit tile row at a time.
+void Visualizer::updateLawnImageTile(const LawnGrid& grid, unsigned int tile_column, unsigned int tile_row) {
+    const QRgb mowed_rgb = MOWED_GRASS_COLOR.rgb();
+    const QRgb unmowed_rgb = UNMOWED_GRASS_COLOR.rgb();
+    const unsigned int first_col = tile_column * LawnGrid::TILE_SIZE;
+    const unsigned int first_row = tile_row * LawnGrid::TILE_SIZE;
+    const unsigned int last_col = min(first_col + LawnGrid::TILE_SIZE, grid.getColumnsNumber());
+    const unsigned int last_row = min(first_row + LawnGrid::TILE_SIZE, grid.getRowsNumber());
+
+    for (unsigned int row = first_row; row < last_row; ++row) {
+        int img_row = static_cast<int>(grid.getRowsNumber() - 1 - row);
+        QRgb* pixels = reinterpret_cast<QRgb*>(lawn_image_.scanLine(img_row));
+        uint64_t tile_row_bits = grid.getTileRow(tile_column, row);
+
+        for (unsigned int col = first_col; col < last_col; ++col) {
+            pixels[col] = ((tile_row_bits >> (col - first_col)) & 1u) ? mowed_rgb : unmowed_rgb;
         }
     }
+}
+
+// Draws the persistent lawn image stretched to fit the screen using the calculated scale.
+// Antialiasing is temporarily disabled to keep grass cells sharp and prevent blending
+// between mowed/unmowed areas.
+void Visualizer::renderLawn(QPainter& painter) const {
+    if (isLawnDataEmpty() || lawn_image_.isNull()) return;
 
     QPointF top_left_px = mapToScreen(0, static_simulation_data_.lawn_length_);
     double w_px = static_simulation_data_.lawn_width_ * scale_factor_;
@@ -187,7 +225,7 @@ void Visualizer::renderLawn(QPainter& painter) const {
     bool old_aa = painter.renderHints().testFlag(QPainter::Antialiasing);
     painter.setRenderHint(QPainter::Antialiasing, false);
     
-    painter.drawImage(target_rect, lawn_image);
+    painter.drawImage(target_rect, lawn_image_);
     
     painter.setRenderHint(QPainter::Antialiasing, old_aa);
 }
@@ -204,15 +242,15 @@ void Visualizer::calculateMowerRenderSize(double mower_width, double mower_lengt
     out_h_px = display_length_cm * scale_factor_;
 }
 
-void Visualizer::renderMower(QPainter& painter, const SimulationSnapshot& sim_snapshot) const {
+void Visualizer::renderMower(QPainter& painter, const InterpolatedPose& pose) const {
     double mower_w_px, mower_h_px;
     calculateMowerRenderSize(static_simulation_data_.width_cm_, static_simulation_data_.length_cm, 
                             static_simulation_data_.blade_diameter_cm, mower_w_px, mower_h_px);
     painter.save();
 
-    QPointF center_pos = mapToScreen(sim_snapshot.x_, sim_snapshot.y_);
+    QPointF center_pos = mapToScreen(pose.x_, pose.y_);
     painter.translate(center_pos);
-    painter.rotate(sim_snapshot.angle_);
+    painter.rotate(pose.angle_);
     
     QRectF target_rect(-mower_w_px / 2.0, -mower_h_px / 2.0, mower_w_px, mower_h_px);
     
@@ -223,7 +261,8 @@ void Visualizer::renderMower(QPainter& painter, const SimulationSnapshot& sim_sn
 void Visualizer::renderPoints(QPainter& painter) const {
     double MIN_POINT_HEIGHT = 30.0;
     double POINT_PROPORTION = 0.05;
-    const auto& points = current_sim_snapshot_.points_;
+    if (!current_sim_snapshot_) return;
+    const auto& points = current_sim_snapshot_->points_;
 
     double point_height = height() * POINT_PROPORTION;
     
@@ -5,10 +5,12 @@
 */
 
 #include "commands/AddPointCommand.h"
+#include "Tracer.h"
 
 AddPointCommand::AddPointCommand(double x, double y) : x_(x), y_(y) {}
 
 bool AddPointCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("AddPointCommand::execute");
     sim.simulateAddPoint(x_, y_);
     return true;
 }
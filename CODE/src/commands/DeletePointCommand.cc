@@ -7,10 +7,12 @@
 */
 
 #include "commands/DeletePointCommand.h"
+#include "Tracer.h"
 
 DeletePointCommand::DeletePointCommand(unsigned int id) : id_(id) {}
 
 bool DeletePointCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("DeletePointCommand::execute");
     sim.simulateDeletePoint(id_);
     return true;
 }
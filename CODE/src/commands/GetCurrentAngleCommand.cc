@@ -3,11 +3,13 @@
 */
 
 #include "commands/GetCurrentAngleCommand.h"
+#include "Tracer.h"
 
 GetCurrentAngleCommand::GetCurrentAngleCommand(unsigned short& output_angle) 
     : output_angle_(output_angle) {}
 
 bool GetCurrentAngleCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("GetCurrentAngleCommand::execute");
     output_angle_ = sim.getMower().getAngle();
     return true;
 }
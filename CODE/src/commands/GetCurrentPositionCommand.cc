@@ -5,17 +5,20 @@
 */
 
 #include "commands/GetCurrentPositionCommand.h"
-#include <string>
+#include "LogEvent.h"
+#include "Tracer.h"
 
 GetCurrentPositionCommand::GetCurrentPositionCommand(double& outX, double& outY)
     : out_x_(outX), out_y_(outY) {}
 
 bool GetCurrentPositionCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("GetCurrentPositionCommand::execute");
     out_x_ = sim.getMower().getX();
     out_y_ = sim.getMower().getY();
 
-    std::string msg = "Current position: (" + std::to_string(out_x_) + ", " + std::to_string(out_y_) + ")";
-    sim.getFileLogger().saveMessage(msg);
+    if (sim.getLogFilter().isEnabled(LogCategory::MOTION, LogLevel::INFO)) {
+        sim.getFileLogger().saveEvent(LogEvent::createCurrentPosition(out_x_, out_y_));
+    }
 
     return true;
 }
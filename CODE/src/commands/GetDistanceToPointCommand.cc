@@ -6,7 +6,8 @@
 
 #include "commands/GetDistanceToPointCommand.h"
 #include <cmath>
-#include <string>
+#include "LogEvent.h"
+#include "Tracer.h"
 
 GetDistanceToPointCommand::GetDistanceToPointCommand(unsigned int pointId, double& outDistance)
     : point_id_(pointId), out_distance_(outDistance) {}
@@ -14,6 +15,7 @@ GetDistanceToPointCommand::GetDistanceToPointCommand(unsigned int pointId, doubl
 // Calculates the distance from the mower to a specific point and stores it
 // in the output reference variable (completes in one frame).
 bool GetDistanceToPointCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("GetDistanceToPointCommand::execute");
     auto coords = sim.getPointCoordinates(point_id_);
     if (!coords) {
         logPointNotFoundError(sim);
@@ -28,8 +30,9 @@ bool GetDistanceToPointCommand::execute(StateSimulation& sim, double dt) {
 }
 
 void GetDistanceToPointCommand::logPointNotFoundError(StateSimulation& sim) const {
-    std::string msg = "Error: Point " + std::to_string(point_id_) + " not found for GetDistanceToPoint.";
-    sim.getFileLogger().saveMessage(msg);
+    if (sim.getLogFilter().isEnabled(LogCategory::ERRORS, LogLevel::ERROR)) {
+        sim.getFileLogger().saveEvent(LogEvent::createDistancePointNotFound(point_id_));
+    }
 }
 
 double GetDistanceToPointCommand::calculateDistanceFromMowerToPoint(const StateSimulation& sim, double target_x, double target_y) const {
@@ -41,6 +44,7 @@ double GetDistanceToPointCommand::calculateDistanceFromMowerToPoint(const StateS
 }
 
 void GetDistanceToPointCommand::logDistanceResult(StateSimulation& sim, double distance) const {
-    std::string msg = "Distance to point " + std::to_string(point_id_) + ": " + std::to_string(distance);
-    sim.getFileLogger().saveMessage(msg);
+    if (sim.getLogFilter().isEnabled(LogCategory::POINTS, LogLevel::INFO)) {
+        sim.getFileLogger().saveEvent(LogEvent::createDistanceToPoint(point_id_, distance));
+    }
 }
@@ -7,6 +7,7 @@
 #include "commands/MoveCommand.h"
 #include "Constants.h"
 #include <string>
+#include "Tracer.h"
 
 using namespace std;
 
@@ -22,12 +23,8 @@ MoveCommand::MoveCommand(const double* distance_ptr, double scale)
 // Example of a situation where this is useful is in main where we first calculate
 // the total distance of the path and then pass a pointer to it to the MoveCommand.
 bool MoveCommand::execute(StateSimulation& sim, double dt) {
-    if (!initialized_) {
-        if (deferred_distance_) {
-            distance_left_ = (*deferred_distance_) * scale_;
-        }
-        initialized_ = true;
-    }
+    TRACE_SCOPE("MoveCommand::execute");
+    initializeDistance();
 
     if (distance_left_ <= 0) return true;
 
@@ -40,3 +37,27 @@ bool MoveCommand::execute(StateSimulation& sim, double dt) {
 
     return distance_left_ <= Constants::DISTANCE_PRECISION;
 }
+
+// Moves the mower by the steps it would make every dt until the end time (or the whole distance) at once:
+// one cut, one log and one time update instead of one per step. Ends in the same place and time as
+// the steps made by execute.
+bool MoveCommand::executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) {
+    TRACE_SCOPE("MoveCommand::executeUntil");
+    initializeDistance();
+
+    if (distance_left_ <= 0) return true;
+
+    double step = sim.getMower().getSpeed() * dt;
+    distance_left_ -= sim.simulateMovementInSteps(distance_left_, step, end_time);
+
+    return distance_left_ <= Constants::DISTANCE_PRECISION;
+}
+
+void MoveCommand::initializeDistance() {
+    if (!initialized_) {
+        if (deferred_distance_) {
+            distance_left_ = (*deferred_distance_) * scale_;
+        }
+        initialized_ = true;
+    }
+}
@@ -8,9 +8,14 @@
 #include "Constants.h"
 #include <cmath>
 #include <algorithm>
+#include "Tracer.h"
 
 using namespace std;
 
+namespace {
+    constexpr double ARRIVAL_DISTANCE = 3.0; // cm
+}
+
 MoveToPointCommand::MoveToPointCommand(unsigned int pointId) 
     : point_id_(pointId) 
 {}
@@ -18,6 +23,7 @@ MoveToPointCommand::MoveToPointCommand(unsigned int pointId)
 // Navigates the mower to a specific point. Handles rotation towards the target
 // and movement in that direction. Runs over multiple frames until arrival.
 bool MoveToPointCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("MoveToPointCommand::execute");
     if (!initialized_) {
         if (!initializeTarget(sim)) {
             return true; 
@@ -44,6 +50,43 @@ bool MoveToPointCommand::execute(StateSimulation& sim, double dt) {
     return false;
 }
 
+// Navigates the mower to the point in legs resolved at once: rotation by the frames it would make every dt
+// until it faces the target, then movement in steps of dt towards it. Headings are whole degrees, so a long 
+// straight leg would miss the target - such a leg ends halfway, where a small correction of the heading
+// is made (as the frames of execute do). Stops at arrival or after the last frame, which starts before 
+// the end time.
+bool MoveToPointCommand::executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) {
+    TRACE_SCOPE("MoveToPointCommand::executeUntil");
+    if (!initialized_) {
+        if (!initializeTarget(sim)) {
+            return true; 
+        }
+    }
+
+    double max_rotation_step = static_cast<double>(Constants::ROTATION_SPEED) * dt;
+    double move_step = sim.getMower().getSpeed() * dt;
+    while (true) {
+        if (hasArrivedAtTarget(sim, calculateDistanceToTarget(sim))) {
+            return true;
+        }
+        u_int64_t leg_start_time = sim.getTime();
+        if (leg_start_time >= end_time) {
+            return false;
+        }
+
+        short rotation_needed = sim.calculateNavigationVector(target_x_, target_y_).first;
+        if (sim.simulateRotationInSteps(rotation_needed, max_rotation_step, rotation_accumulator_, end_time) != 
+                rotation_needed) {
+            return false;
+        }
+        sim.simulateMovementInSteps(calculateLegLength(sim), move_step, end_time);
+
+        if (sim.getTime() == leg_start_time) {
+            return false;
+        }
+    }
+}
+
 // Retrieves target point coordinates on first execution.
 bool MoveToPointCommand::initializeTarget(StateSimulation& sim) {
     auto coords = sim.getPointCoordinates(point_id_);
@@ -64,8 +107,19 @@ double MoveToPointCommand::calculateDistanceToTarget(const StateSimulation& sim)
     return sqrt(dx*dx + dy*dy);
 }
 
+// Length of the straight leg: up to the point of the mower's heading line closest to the target, when it
+// is well within the arrival distance, or half of it otherwise.
+double MoveToPointCommand::calculateLegLength(const StateSimulation& sim) const {
+    double dx = target_x_ - sim.getMower().getX();
+    double dy = target_y_ - sim.getMower().getY();
+    double along_heading = dx * sim.getMower().getHeadingX() + dy * sim.getMower().getHeadingY();
+    double miss = abs(dx * sim.getMower().getHeadingY() - dy * sim.getMower().getHeadingX());
+
+    return miss <= ARRIVAL_DISTANCE / 2.0 ? along_heading : along_heading / 2.0;
+}
+
 bool MoveToPointCommand::hasArrivedAtTarget(StateSimulation& sim, double currentDistance) const {
-    if (currentDistance <= 3.0) {
+    if (currentDistance <= ARRIVAL_DISTANCE) {
         sim.logArrivalAtPoint(point_id_);
         return true;
     }
@@ -5,10 +5,12 @@
 */
 
 #include "commands/MowingOptionCommand.h"
+#include "Tracer.h"
 
 MowingOptionCommand::MowingOptionCommand(bool enable) : enable_(enable) {}
 
 bool MowingOptionCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("MowingOptionCommand::execute");
     if (enable_) {
         sim.simulateMowingOptionOn();
     } else {
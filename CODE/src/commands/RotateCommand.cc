@@ -8,6 +8,7 @@
 #include "Constants.h"
 #include <cmath>
 #include <algorithm>
+#include "Tracer.h"
 
 using namespace std;
 
@@ -16,6 +17,7 @@ RotateCommand::RotateCommand(short angle) : angle_left_(angle) {}
 // Rotates the mower by a specified angle over multiple frames.
 // Uses an accumulator to handle smooth sub-degree rotation.
 bool RotateCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("RotateCommand::execute");
     if (isRotationFinished()) {
         return true;
     }
@@ -26,6 +28,34 @@ bool RotateCommand::execute(StateSimulation& sim, double dt) {
     return isRotationFinished();
 }
 
+// Rotates the mower by the frames it would make every dt until the end time (or the end of the rotation)
+// at once: one rotation, one log and one time update. Every frame takes as long as its separate rotation,
+// so the mower ends at the same angle and time as after the frames made by execute.
+bool RotateCommand::executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) {
+    TRACE_SCOPE("RotateCommand::executeUntil");
+    if (isRotationFinished()) {
+        return true;
+    }
+    // Frames shorter than half a degree never finish the rotation, so they are not made at once
+    if (abs(calculateRotationStepForFrame(dt)) < 0.5) {
+        return execute(sim, dt);
+    }
+
+    short rotation = 0;
+    u_int64_t duration = 0;
+    do {
+        updateInternalRotationState(calculateRotationStepForFrame(dt));
+        short frame_rotation = takeAccumulatedRotation();
+        rotation += frame_rotation;
+        duration += sim.calculateRotationDuration(frame_rotation);
+    } while (!isRotationFinished() && sim.getTime() + duration < end_time);
+
+    if (rotation != 0) {
+        sim.simulateRotation(rotation, duration);
+    }
+    return isRotationFinished();
+}
+
 double RotateCommand::calculateRotationStepForFrame(double dt) const {
     double max_rot_speed = static_cast<double>(Constants::ROTATION_SPEED);
     double max_step = max_rot_speed * dt;
@@ -48,14 +78,23 @@ void RotateCommand::updateInternalRotationState(double step) {
     }
 }
 
-void RotateCommand::applyAccumulatedRotationToSimulation(StateSimulation& sim) {
+// Takes whole degrees out of the accumulator, leaving the sub-degree rest for the next frames.
+short RotateCommand::takeAccumulatedRotation() {
     constexpr double MIN_DEGREE_THRESHOLD = 1.0;
     
-    if (abs(rotation_accumulator_) >= MIN_DEGREE_THRESHOLD) {
-        short actual_rot_to_apply = static_cast<short>(rotation_accumulator_);
-        
+    if (abs(rotation_accumulator_) < MIN_DEGREE_THRESHOLD) {
+        return 0;
+    }
+    short actual_rot_to_apply = static_cast<short>(rotation_accumulator_);
+    rotation_accumulator_ -= actual_rot_to_apply;
+    return actual_rot_to_apply;
+}
+
+void RotateCommand::applyAccumulatedRotationToSimulation(StateSimulation& sim) {
+    short actual_rot_to_apply = takeAccumulatedRotation();
+    
+    if (actual_rot_to_apply != 0) {
         sim.simulateRotation(actual_rot_to_apply);
-        rotation_accumulator_ -= actual_rot_to_apply;
     }
 }
 
@@ -8,6 +8,7 @@
 #include "Constants.h"
 #include <cmath>
 #include <algorithm>
+#include "Tracer.h"
 
 using namespace std;
 
@@ -17,6 +18,7 @@ RotateTowardsPointCommand::RotateTowardsPointCommand(unsigned int pointId)
 // Rotates the mower to face a specific point. Runs over multiple frames
 // until the mower is aligned with the target direction.
 bool RotateTowardsPointCommand::execute(StateSimulation& sim, double dt) {
+    TRACE_SCOPE("RotateTowardsPointCommand::execute");
     if (!initialized_) {
         if (!initializeTarget(sim)) {
             return true; 
@@ -37,6 +39,21 @@ bool RotateTowardsPointCommand::execute(StateSimulation& sim, double dt) {
     return false;
 }
 
+// Rotates the mower by the frames it would make every dt at once, until it faces the point 
+// (the whole rotation needed, not only within the alignment tolerance) or the end time is reached.
+bool RotateTowardsPointCommand::executeUntil(StateSimulation& sim, double dt, u_int64_t end_time) {
+    TRACE_SCOPE("RotateTowardsPointCommand::executeUntil");
+    if (!initialized_) {
+        if (!initializeTarget(sim)) {
+            return true; 
+        }
+    }
+
+    short rotation_needed = sim.calculateNavigationVector(target_x_, target_y_).first;
+    double max_step = static_cast<double>(Constants::ROTATION_SPEED) * dt;
+    return sim.simulateRotationInSteps(rotation_needed, max_step, rotation_accumulator_, end_time) == rotation_needed;
+}
+
 bool RotateTowardsPointCommand::initializeTarget(StateSimulation& sim) {
     auto coords = sim.getPointCoordinates(point_id_);
     if (!coords) {
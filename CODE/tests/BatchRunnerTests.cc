@@ -0,0 +1,188 @@
+/*
+    Author: Hanna Biegacz
+
+    Tests BatchRunner class.
+*/
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/BatchRunner.h"
+#include "../include/Scenario.h"
+
+using namespace std;
+
+
+TEST(BatchRunnerRunScenario, straightLineResult) {
+    istringstream input(
+        "lawn 1000 1000\n"
+        "mower 50 50 40 100\n"
+        "start 500 100 0\n"
+        "commands\n"
+        "move 300\n");
+    Scenario scenario = ScenarioParser::parse(input, "line");
+
+    ScenarioResult result = BatchRunner::runScenario(scenario);
+
+    EXPECT_EQ("line", result.name_);
+    EXPECT_TRUE(result.is_finished_);
+    EXPECT_TRUE(result.error_.empty());
+    EXPECT_NEAR(300.0, result.path_length_, 0.01);
+    EXPECT_EQ(3000u, result.simulation_time_);
+    EXPECT_EQ(1u, result.steps_number_); // 150 steps of 2 cm moved at once
+    EXPECT_NEAR((300.0 * 40.0 + 3.14159 * 20.0 * 20.0) / 1e6, result.coverage_, 0.0002);
+    EXPECT_GE(result.wall_time_, 0.0);
+}
+
+
+TEST(BatchRunnerRunScenario, mowingOffCutsNothing) {
+    istringstream input(
+        "lawn 1000 1000\n"
+        "mower 50 50 40 100\n"
+        "start 500 100 0\n"
+        "commands\n"
+        "mowing off\n"
+        "move 300\n"
+        "rotate 90\n");
+    Scenario scenario = ScenarioParser::parse(input, "off");
+
+    ScenarioResult result = BatchRunner::runScenario(scenario);
+
+    EXPECT_TRUE(result.is_finished_);
+    EXPECT_DOUBLE_EQ(0.0, result.coverage_);
+    EXPECT_NEAR(300.0, result.path_length_, 0.01);
+}
+
+
+TEST(BatchRunnerRunScenario, timeLimitStopsScenario) {
+    istringstream input(
+        "lawn 1000 1000\n"
+        "mower 50 50 40 100\n"
+        "start 500 100 0\n"
+        "max_time 1\n"
+        "commands\n"
+        "move 300\n");
+    Scenario scenario = ScenarioParser::parse(input, "limit");
+
+    ScenarioResult result = BatchRunner::runScenario(scenario);
+
+    EXPECT_FALSE(result.is_finished_);
+    EXPECT_EQ(1000u, result.simulation_time_);
+    EXPECT_NEAR(100.0, result.path_length_, 0.01);
+}
+
+
+TEST(BatchRunnerRunScenario, moveOutsideLawnReported) {
+    istringstream input(
+        "lawn 1000 1000\n"
+        "mower 50 50 40 100\n"
+        "start 500 900 0\n"
+        "commands\n"
+        "move 300\n");
+    Scenario scenario = ScenarioParser::parse(input, "outside");
+
+    ScenarioResult result = BatchRunner::runScenario(scenario);
+
+    EXPECT_FALSE(result.is_finished_);
+    EXPECT_FALSE(result.error_.empty());
+    EXPECT_EQ(1u, result.errors_number_);
+    EXPECT_NEAR(100.0, result.path_length_, 2.0);
+}
+
+
+TEST(BatchRunnerRunScenario, arrivalAtPointIsNotError) {
+    istringstream input(
+        "lawn 1000 1000\n"
+        "mower 50 50 40 100\n"
+        "start 500 100 0\n"
+        "commands\n"
+        "add_point 500 400\n"
+        "move_to_point 0\n"
+        "delete_point 5\n");
+    Scenario scenario = ScenarioParser::parse(input, "points");
+
+    ScenarioResult result = BatchRunner::runScenario(scenario);
+
+    EXPECT_TRUE(result.is_finished_);
+    EXPECT_EQ(1u, result.errors_number_); // only the incorrect point id
+}
+
+
+
+namespace {
+    Scenario createSweepScenario(const unsigned int& blade_diameter) {
+        istringstream input(
+            "lawn 1000 1000\n"
+            "mower 50 50 " + to_string(blade_diameter) + " 100\n"
+            "start 500 100 0\n"
+            "commands\n"
+            "repeat 4\n"
+            "    move 100\n"
+            "    rotate 90\n"
+            "end\n");
+        return ScenarioParser::parse(input, "blade_" + to_string(blade_diameter));
+    }
+}
+
+
+TEST(BatchRunnerRunScenarios, resultsInScenariosOrder) {
+    vector<Scenario> scenarios;
+    for (unsigned int blade_diameter = 10; blade_diameter <= 100; blade_diameter += 10) {
+        scenarios.push_back(createSweepScenario(blade_diameter));
+    }
+
+    vector<ScenarioResult> results = BatchRunner::runScenarios(scenarios, 4);
+
+    ASSERT_EQ(scenarios.size(), results.size());
+    for (size_t i = 0; i < scenarios.size(); ++i) {
+        ScenarioResult expected = BatchRunner::runScenario(scenarios[i]);
+        EXPECT_EQ(scenarios[i].name_, results[i].name_);
+        EXPECT_TRUE(results[i].is_finished_);
+        EXPECT_DOUBLE_EQ(expected.coverage_, results[i].coverage_);
+        EXPECT_EQ(expected.simulation_time_, results[i].simulation_time_);
+        EXPECT_DOUBLE_EQ(expected.path_length_, results[i].path_length_);
+        EXPECT_EQ(expected.errors_number_, results[i].errors_number_);
+    }
+    for (size_t i = 1; i < results.size(); ++i) {
+        EXPECT_GT(results[i].coverage_, results[i - 1].coverage_);
+    }
+}
+
+
+TEST(BatchRunnerRunScenarios, moreThreadsThanScenarios) {
+    vector<Scenario> scenarios = {createSweepScenario(20), createSweepScenario(40)};
+
+    vector<ScenarioResult> results = BatchRunner::runScenarios(scenarios, 16);
+
+    ASSERT_EQ(2u, results.size());
+    EXPECT_EQ("blade_20", results[0].name_);
+    EXPECT_EQ("blade_40", results[1].name_);
+}
+
+
+TEST(BatchRunnerRunScenarios, defaultThreadsNumberAndNoScenarios) {
+    vector<Scenario> scenarios = {createSweepScenario(30)};
+
+    EXPECT_TRUE(BatchRunner::runScenarios(vector<Scenario>(), 0).empty());
+    vector<ScenarioResult> results = BatchRunner::runScenarios(scenarios, 0);
+    ASSERT_EQ(1u, results.size());
+    EXPECT_TRUE(results[0].is_finished_);
+}
+
+TEST(BatchRunnerFormatResult, formatContainsValues) {
+    ScenarioResult result;
+    result.name_ = "test";
+    result.coverage_ = 0.5;
+    result.simulation_time_ = 1500;
+    result.path_length_ = 12.0;
+    result.is_finished_ = true;
+
+    string text = BatchRunner::formatResult(result);
+
+    EXPECT_NE(string::npos, text.find("test"));
+    EXPECT_NE(string::npos, text.find("50.00 %"));
+    EXPECT_NE(string::npos, text.find("1.50 s"));
+    EXPECT_NE(string::npos, text.find("12.00 cm"));
+    EXPECT_NE(string::npos, text.find("finished"));
+}
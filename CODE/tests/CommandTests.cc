@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <cmath>
+#include <limits>
 #include "StateSimulation.h"
 #include "commands/AddPointCommand.h"
 #include "commands/DeletePointCommand.h"
@@ -18,13 +19,11 @@
 #include "Logger.h"
 #include "FileLogger.h"
 #include "Config.h"
+#include "Exceptions.h"
 
 class CommandTests : public ::testing::Test {
 protected:
     void SetUp() override {
-        Config::initializeRuntimeConstants(1000, 1000); 
-        Config::initializeMowerConstants(50, 50, 0, 0, 0);
-
         lawn = std::make_unique<Lawn>(1000, 1000);
         mower = std::make_unique<Mower>(50, 50, 20, 10); 
         logger = std::make_unique<Logger>();
@@ -90,6 +89,63 @@ TEST_F(CommandTests, MoveCommandMovesMowerForward) {
     EXPECT_TRUE(finalX != initialX || finalY != initialY); 
 }
 
+TEST_F(CommandTests, MoveCommandExecuteUntilMatchesSteps) {
+    Lawn stepped_lawn(1000, 1000);
+    Mower stepped_mower(50, 50, 40, 100, 200.0, 200.0, 30);
+    StateSimulation stepped_simulation(stepped_lawn, stepped_mower, *logger, *fileLogger);
+    MoveCommand stepped_command(333.3);
+    while (!stepped_command.execute(stepped_simulation, 0.02));
+
+    Lawn lawn_at_once(1000, 1000);
+    Mower mower_at_once(50, 50, 40, 100, 200.0, 200.0, 30);
+    StateSimulation simulation_at_once(lawn_at_once, mower_at_once, *logger, *fileLogger);
+    MoveCommand command_at_once(333.3);
+
+    EXPECT_TRUE(command_at_once.executeUntil(simulation_at_once, 0.02, std::numeric_limits<u_int64_t>::max()));
+    EXPECT_EQ(stepped_simulation.getTime(), simulation_at_once.getTime());
+    EXPECT_NEAR(stepped_mower.getX(), mower_at_once.getX(), 0.01);
+    EXPECT_NEAR(stepped_mower.getY(), mower_at_once.getY(), 0.01);
+    EXPECT_NEAR(stepped_lawn.calculateShavedArea(), lawn_at_once.calculateShavedArea(), 1e-4);
+}
+
+TEST_F(CommandTests, MoveCommandExecuteUntilStopsAtEndTime) {
+    mower = std::make_unique<Mower>(50, 50, 20, 100, 500.0, 100.0, 0);
+    simulation = std::make_unique<StateSimulation>(*lawn, *mower, *logger, *fileLogger);
+    MoveCommand command(300.0);
+
+    // Step which starts before the end time is finished
+    EXPECT_FALSE(command.executeUntil(*simulation, 0.02, 1010));
+    EXPECT_EQ(1020u, simulation->getTime());
+    EXPECT_NEAR(202.0, simulation->getMower().getY(), 1e-9);
+
+    EXPECT_TRUE(command.executeUntil(*simulation, 0.02, 100000));
+    EXPECT_EQ(3000u, simulation->getTime());
+    EXPECT_NEAR(400.0, simulation->getMower().getY(), 1e-9);
+}
+
+TEST_F(CommandTests, MoveCommandExecuteUntilStopsAtLawnBorder) {
+    mower = std::make_unique<Mower>(50, 50, 20, 100, 500.0, 900.0, 0);
+    simulation = std::make_unique<StateSimulation>(*lawn, *mower, *logger, *fileLogger);
+    MoveCommand command(300.0);
+
+    EXPECT_THROW(command.executeUntil(*simulation, 0.02, std::numeric_limits<u_int64_t>::max()), 
+        MoveOutsideLawnError);
+    EXPECT_NEAR(1000.0, simulation->getMower().getY(), 1e-9);
+    EXPECT_EQ(1000u, simulation->getTime());
+    EXPECT_EQ(1u, simulation->getLogger().getLogs().size());
+}
+
+TEST_F(CommandTests, MoveCommandExecuteUntilEndsOnLawnBorder) {
+    // Border (1000.001) is 5.9996 cm away - the third step ends on it after rounding
+    mower = std::make_unique<Mower>(50, 50, 20, 100, 500.0, 994.0014, 0);
+    simulation = std::make_unique<StateSimulation>(*lawn, *mower, *logger, *fileLogger);
+    MoveCommand command(6.0);
+
+    EXPECT_TRUE(command.executeUntil(*simulation, 0.02, std::numeric_limits<u_int64_t>::max()));
+    EXPECT_NEAR(1000.001, simulation->getMower().getY(), 1e-9);
+    EXPECT_EQ(60u, simulation->getTime());
+}
+
 TEST_F(CommandTests, RotateCommandRotatesMower) {
     double initialAngle = simulation->getMower().getAngle();
     RotateCommand command(90); 
@@ -103,6 +159,34 @@ TEST_F(CommandTests, RotateCommandRotatesMower) {
     EXPECT_EQ(finalAngle, expectedAngle);
 }
 
+TEST_F(CommandTests, RotateCommandExecuteUntilMatchesFrames) {
+    for (short angle : {90, -90, 30, 7}) {
+        Mower stepped_mower(50, 50, 20, 10, 500.0, 500.0, 30);
+        StateSimulation stepped_simulation(*lawn, stepped_mower, *logger, *fileLogger);
+        RotateCommand stepped_command(angle);
+        while (!stepped_command.execute(stepped_simulation, 0.02));
+
+        Mower mower_at_once(50, 50, 20, 10, 500.0, 500.0, 30);
+        StateSimulation simulation_at_once(*lawn, mower_at_once, *logger, *fileLogger);
+        RotateCommand command_at_once(angle);
+
+        EXPECT_TRUE(command_at_once.executeUntil(simulation_at_once, 0.02, std::numeric_limits<u_int64_t>::max()));
+        EXPECT_EQ(stepped_mower.getAngle(), mower_at_once.getAngle()) << angle;
+        EXPECT_EQ(stepped_simulation.getTime(), simulation_at_once.getTime()) << angle;
+    }
+}
+
+TEST_F(CommandTests, RotateCommandExecuteUntilStopsAtEndTime) {
+    RotateCommand command(90);
+
+    // Frames of 1.8 degree rotate by 1 or 2 degrees, 20 or 30 ms each; the one started before 50 ms is finished
+    EXPECT_FALSE(command.executeUntil(*simulation, 0.02, 50));
+    EXPECT_EQ(3, simulation->getMower().getAngle());
+    EXPECT_EQ(50u, simulation->getTime());
+
+    EXPECT_TRUE(command.executeUntil(*simulation, 0.02, std::numeric_limits<u_int64_t>::max()));
+}
+
 TEST_F(CommandTests, GetDistanceToPointCommandCalculatesCorrectDistance) {
     simulation->simulateAddPoint(10.0, 0.0); 
     
@@ -155,9 +239,53 @@ TEST_F(CommandTests, MoveToPointCommandMovesMowerToPoint) {
     EXPECT_NEAR(mowerY, 50.0, 2.0);
 }
 
+TEST_F(CommandTests, RotateTowardsPointCommandExecuteUntilFacesPoint) {
+    simulation->simulateAddPoint(100.0, 100.0); 
+    unsigned int pointId = simulation->getPoints().back().getId();
+    RotateTowardsPointCommand command(pointId);
+
+    EXPECT_TRUE(command.executeUntil(*simulation, 0.02, std::numeric_limits<u_int64_t>::max()));
+    EXPECT_EQ(45, simulation->getMower().getAngle());
+    EXPECT_EQ(0, simulation->calculateNavigationVector(100.0, 100.0).first);
+}
+
+TEST_F(CommandTests, MoveToPointCommandExecuteUntilResolvesLegsAtOnce) {
+    Mower stepped_mower(50, 50, 20, 100, 100.0, 100.0, 0);
+    StateSimulation stepped_simulation(*lawn, stepped_mower, *logger, *fileLogger);
+    stepped_simulation.simulateAddPoint(900.0, 850.0); 
+    MoveToPointCommand stepped_command(stepped_simulation.getPoints().back().getId());
+    while (!stepped_command.execute(stepped_simulation, 0.02));
+
+    Mower mower_at_once(50, 50, 20, 100, 100.0, 100.0, 0);
+    StateSimulation simulation_at_once(*lawn, mower_at_once, *logger, *fileLogger);
+    simulation_at_once.simulateAddPoint(900.0, 850.0); 
+    MoveToPointCommand command_at_once(simulation_at_once.getPoints().back().getId());
+
+    EXPECT_TRUE(command_at_once.executeUntil(simulation_at_once, 0.02, std::numeric_limits<u_int64_t>::max()));
+    EXPECT_NEAR(900.0, mower_at_once.getX(), 3.0);
+    EXPECT_NEAR(850.0, mower_at_once.getY(), 3.0);
+    // Legs follow the straight line as the frames do, so the leg of 1096.6 cm takes about as long
+    EXPECT_NEAR(static_cast<double>(stepped_simulation.getTime()), static_cast<double>(simulation_at_once.getTime()), 
+        0.01 * stepped_simulation.getTime());
+}
+
+TEST_F(CommandTests, MoveToPointCommandExecuteUntilStopsAtEndTime) {
+    mower = std::make_unique<Mower>(50, 50, 20, 100, 100.0, 100.0, 0);
+    simulation = std::make_unique<StateSimulation>(*lawn, *mower, *logger, *fileLogger);
+    simulation->simulateAddPoint(100.0, 900.0); 
+    unsigned int pointId = simulation->getPoints().back().getId();
+    MoveToPointCommand command(pointId);
+
+    EXPECT_FALSE(command.executeUntil(*simulation, 0.02, 4000));
+    EXPECT_EQ(4000u, simulation->getTime());
+    EXPECT_NEAR(500.0, simulation->getMower().getY(), 1e-9);
+
+    EXPECT_TRUE(command.executeUntil(*simulation, 0.02, std::numeric_limits<u_int64_t>::max()));
+    EXPECT_NEAR(900.0, simulation->getMower().getY(), 3.0);
+}
+
 TEST_F(CommandTests, GetCurrentPositionCommandRetrievesMowerPosition) {
-    Config::initializeMowerConstants(50, 50, 100.0, 200.0, 0);
-    mower = std::make_unique<Mower>(50, 50, 20, 10);
+    mower = std::make_unique<Mower>(50, 50, 20, 10, 100.0, 200.0, 0);
     simulation = std::make_unique<StateSimulation>(*lawn, *mower, *logger, *fileLogger);
 
     double outX = 0.0, outY = 0.0;
@@ -170,8 +298,7 @@ TEST_F(CommandTests, GetCurrentPositionCommandRetrievesMowerPosition) {
 
 TEST_F(CommandTests, GetCurrentAngleCommandRetrievesMowerAngle) {
     const unsigned short initialAngle = 45;
-    Config::initializeMowerConstants(50, 50, 0, 0, initialAngle);
-    mower = std::make_unique<Mower>(50, 50, 20, 10);
+    mower = std::make_unique<Mower>(50, 50, 20, 10, 0, 0, initialAngle);
     simulation = std::make_unique<StateSimulation>(*lawn, *mower, *logger, *fileLogger);
 
     unsigned short outAngle = 0;
@@ -3,6 +3,10 @@
 #include <thread>
 #include <mutex>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
 
 #include "Engine.h"
 #include "StateSimulation.h"
@@ -388,11 +392,8 @@ TEST_F(EngineTests, simulationStopsOnMoveOutsideLawn) {
     unsigned int blade_diameter = 8;
     unsigned int mower_speed = 100;
 
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 50.0, 50.0, 0);
-
     Lawn lawn(lawn_width, lawn_length);
-    Mower mower(mower_width, mower_length, blade_diameter, mower_speed);
+    Mower mower(mower_width, mower_length, blade_diameter, mower_speed, 50.0, 50.0, 0);
     Logger logger;
     FileLogger fileLogger("test_exception_logs.log");
     StateSimulation sim(lawn, mower, logger, fileLogger);
@@ -418,4 +419,199 @@ TEST_F(EngineTests, simulationStopsOnMoveOutsideLawn) {
 
     EXPECT_TRUE(stopped);
     EXPECT_FALSE(engine.isRunning());
-}
\ No newline at end of file
+}
+TEST_F(EngineTests, SnapshotDecimationRejectsZero) {
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    Lawn lawn(100, 100);
+    Mower mower(30, 40, 15, 20);
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+    Engine engine(simulation);
+
+    EXPECT_FALSE(engine.isFreeRunning());
+    EXPECT_EQ(1u, engine.getSnapshotDecimation());
+
+    engine.setSnapshotDecimation(100);
+    EXPECT_EQ(100u, engine.getSnapshotDecimation());
+
+    engine.setSnapshotDecimation(0);
+    EXPECT_EQ(100u, engine.getSnapshotDecimation());
+}
+
+TEST_F(EngineTests, FreeRunningIgnoresRealTime) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 10000;
+    unsigned int mower_speed = 100;
+
+    Lawn lawn(lawn_width, lawn_length);
+    Mower mower(10, 10, 8, mower_speed, 500.0, 100.0, 0);
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    StateSimulation sim(lawn, mower, logger, fileLogger);
+
+    MowerController controller;
+    controller.move(9000.0);
+    std::atomic<bool> finished(false);
+
+    Engine engine(sim, [&controller, &finished](StateSimulation& s, double dt) {
+        controller.update(s, dt);
+        finished = !controller.hasPendingCommands();
+    });
+    Visualizer visualizer(engine.getStateInterpolator());
+    engine.setFreeRunning(true);
+    engine.setSnapshotDecimation(500);
+
+    engine.start();
+    auto start_time = std::chrono::steady_clock::now();
+    while (!finished.load() && std::chrono::steady_clock::now() - start_time < std::chrono::seconds(5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    engine.stop();
+
+    // 90 s of simulated movement, in real time mode it would take 90 s of wall time
+    EXPECT_TRUE(finished.load());
+    EXPECT_GE(engine.getSimulationTime(), 90000.0);
+}
+
+TEST_F(EngineTests, CanSwitchFreeRunningWhileRunning) {
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    Lawn lawn(100, 100);
+    Mower mower(30, 40, 15, 20);
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+    Engine engine(simulation);
+    Visualizer visualizer(engine.getStateInterpolator());
+
+    std::atomic<int> count(0);
+    engine.setUserSimulationLogic([&](StateSimulation&, double) {
+        count++;
+    });
+
+    engine.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    int real_time_count = count.load();
+
+    engine.setFreeRunning(true);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    engine.setFreeRunning(false);
+    int free_running_count = count.load() - real_time_count;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    engine.stop();
+
+    EXPECT_GT(free_running_count, 10 * real_time_count);
+    EXPECT_FALSE(engine.isFreeRunning());
+}
+
+TEST_F(EngineTests, MetricsAreCollectedAndDumped) {
+    std::string metrics_path = "engine_metrics.txt";
+    std::remove(metrics_path.c_str());
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    Lawn lawn(1000, 1000);
+    Mower mower(30, 40, 20, 100, 500.0, 100.0);
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+    MowerController controller;
+    controller.setMowing(true);
+    controller.move(500.0);
+    Engine engine(simulation, [&controller](StateSimulation& sim, double dt) {
+        controller.update(sim, dt);
+    });
+    engine.setFreeRunning(true);
+    engine.setSnapshotDecimation(10);
+    engine.setMetricsDump(metrics_path, 0.01);
+
+    engine.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    engine.stop();
+
+    const MetricsRegistry& metrics = engine.getMetrics();
+    ASSERT_NE(nullptr, metrics.findCounter("ticks"));
+    uint64_t ticks = metrics.findCounter("ticks")->get();
+    EXPECT_GT(ticks, 250u);
+    EXPECT_EQ(ticks, metrics.findHistogram("tick_duration_ns")->getCount());
+    EXPECT_EQ(ticks, metrics.findHistogram("state_lock_wait_ns")->getCount());
+    EXPECT_EQ(ticks, metrics.findHistogram("cut_fields_per_tick")->getCount());
+    EXPECT_GT(metrics.findHistogram("cut_fields_per_tick")->getMax(), 0u);
+    EXPECT_GT(metrics.findHistogram("snapshot_build_ns")->getCount(), 0u);
+    EXPECT_LE(metrics.findHistogram("steps_per_wakeup")->getMax(), 10u);
+
+    std::ifstream metrics_file(metrics_path);
+    std::stringstream content;
+    content << metrics_file.rdbuf();
+    EXPECT_NE(std::string::npos, content.str().find("ticks " + std::to_string(ticks) + "\n"));
+    EXPECT_NE(std::string::npos, content.str().find("tick_duration_ns count=" + std::to_string(ticks)));
+    std::remove(metrics_path.c_str());
+}
+
+TEST_F(EngineTests, EventDrivenLogicAdvancesByDueSteps) {
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    Lawn lawn(100, 100);
+    Mower mower(30, 40, 15, 20);
+    StateSimulation simulation(lawn, mower, logger, fileLogger);
+    Engine engine(simulation);
+    Visualizer visualizer(engine.getStateInterpolator());
+
+    std::atomic<int> count(0);
+    std::atomic<bool> end_time_is_correct(true);
+    engine.setEventDrivenSimulationLogic([&](StateSimulation& sim, double dt, u_int64_t end_time) {
+        u_int64_t duration = end_time - sim.getTime();
+        if (std::abs(dt - 0.02) > 0.001 || duration == 0 || duration % 20 != 0) {
+            end_time_is_correct = false;
+        }
+        count++;
+        return sim.getTime();
+    });
+    EXPECT_TRUE(engine.isEventDriven());
+
+    engine.start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    engine.stop();
+
+    EXPECT_GT(count.load(), 0);
+    EXPECT_TRUE(end_time_is_correct.load()) << "End time should be a whole number of fixed steps ahead";
+
+    engine.setEventDrivenSimulationLogic(nullptr);
+    EXPECT_FALSE(engine.isEventDriven());
+}
+
+TEST_F(EngineTests, EventDrivenLogicJumpsToNextEvent) {
+    Lawn lawn(1000, 10000);
+    Mower mower(10, 10, 8, 100, 500.0, 100.0, 0);
+    Logger logger;
+    FileLogger fileLogger("test.log");
+    StateSimulation sim(lawn, mower, logger, fileLogger);
+
+    MowerController controller;
+    controller.move(9000.0);
+    std::atomic<int> updates_number(0);
+    std::atomic<bool> finished(false);
+
+    Engine engine(sim);
+    engine.setEventDrivenSimulationLogic([&](StateSimulation& s, double dt, u_int64_t end_time) {
+        if (!controller.hasPendingCommands()) {
+            return s.getTime();
+        }
+        u_int64_t reached_time = controller.updateUntil(s, dt, end_time);
+        updates_number++;
+        finished = !controller.hasPendingCommands();
+        return reached_time;
+    });
+    Visualizer visualizer(engine.getStateInterpolator());
+    engine.setFreeRunning(true);
+    engine.setSnapshotDecimation(500);
+
+    engine.start();
+    auto start_time = std::chrono::steady_clock::now();
+    while (!finished.load() && std::chrono::steady_clock::now() - start_time < std::chrono::seconds(5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    engine.stop();
+
+    // 4500 steps of 2 cm in one update - free running mode does not limit the end time
+    EXPECT_TRUE(finished.load());
+    EXPECT_EQ(1, updates_number.load());
+    EXPECT_EQ(90000.0, engine.getSimulationTime());
+    EXPECT_NEAR(9100.0, mower.getY(), 1e-6);
+}
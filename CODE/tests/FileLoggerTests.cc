@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "../include/FileLogger.h"
+#include "../include/Log.h"
+
+using namespace std;
+
+
+namespace {
+    string readFile(const string& path) {
+        ifstream file(path);
+        stringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+}
+
+
+TEST(ConstructorAndGetters, constructorAndGetters) {
+    FlushPolicy policy;
+    policy.flush_interval_ms_ = 0;
+    policy.flush_on_error_ = false;
+    FileLogger file_logger = FileLogger("file_logger_getters.log", policy);
+
+    EXPECT_EQ("file_logger_getters.log", file_logger.getFilePath());
+    EXPECT_EQ(0u, file_logger.getFlushPolicy().flush_interval_ms_);
+    EXPECT_FALSE(file_logger.getFlushPolicy().flush_on_error_);
+}
+
+
+TEST(SaveLog, flushWritesLogsInOrder) {
+    string path = "file_logger_order.log";
+    remove(path.c_str());
+    FileLogger file_logger = FileLogger(path);
+
+    file_logger.saveLog(Log(10, "first"));
+    file_logger.saveMessage("second");
+    file_logger.saveError(Log(30, "third"));
+    file_logger.flush();
+
+    EXPECT_EQ("Time: 10: first\nsecond\nTime: 30: third\n", readFile(path));
+    remove(path.c_str());
+}
+
+
+TEST(SaveLog, copiesShareWriter) {
+    string path = "file_logger_copies.log";
+    remove(path.c_str());
+    FileLogger file_logger = FileLogger(path);
+    FileLogger copy = FileLogger(file_logger);
+
+    for (u_int64_t i = 0; i < 10000; ++i) {
+        (i % 2 == 0 ? file_logger : copy).saveLog(Log(i, "move"));
+    }
+    copy.flush();
+
+    string content = readFile(path);
+    EXPECT_EQ(10000u, static_cast<size_t>(count(content.begin(), content.end(), '\n')));
+    EXPECT_EQ(0u, content.find("Time: 0: move\nTime: 1: move\n"));
+    remove(path.c_str());
+}
+
+
+TEST(FlushPolicy, flushOnDestruction) {
+    string path = "file_logger_destruction.log";
+    remove(path.c_str());
+    {
+        FlushPolicy policy;
+        policy.flush_interval_ms_ = 0;
+        policy.flush_on_error_ = false;
+        FileLogger file_logger = FileLogger(path, policy);
+        file_logger.saveLog(Log(5, "last log"));
+    }
+
+    EXPECT_EQ("Time: 5: last log\n", readFile(path));
+    remove(path.c_str());
+}
+
+
+TEST(FlushPolicy, flushOnError) {
+    string path = "file_logger_error.log";
+    remove(path.c_str());
+    FlushPolicy policy;
+    policy.flush_interval_ms_ = 0;
+    FileLogger file_logger = FileLogger(path, policy);
+
+    file_logger.saveError(Log(7, "Attempted to move outside the lawn."));
+
+    string content;
+    auto start_time = chrono::steady_clock::now();
+    while (content.empty() && chrono::steady_clock::now() - start_time < chrono::seconds(2)) {
+        this_thread::sleep_for(chrono::milliseconds(5));
+        content = readFile(path);
+    }
+    EXPECT_EQ("Time: 7: Attempted to move outside the lawn.\n", content);
+    remove(path.c_str());
+}
+
+
+TEST(FlushPolicy, periodicFlush) {
+    string path = "file_logger_interval.log";
+    remove(path.c_str());
+    FlushPolicy policy;
+    policy.flush_interval_ms_ = 10;
+    policy.flush_on_error_ = false;
+    FileLogger file_logger = FileLogger(path, policy);
+
+    file_logger.saveLog(Log(1, "periodic"));
+
+    string content;
+    auto start_time = chrono::steady_clock::now();
+    while (content.empty() && chrono::steady_clock::now() - start_time < chrono::seconds(2)) {
+        this_thread::sleep_for(chrono::milliseconds(5));
+        content = readFile(path);
+    }
+    EXPECT_EQ("Time: 1: periodic\n", content);
+    remove(path.c_str());
+}
+
+
+TEST(SaveLog, emptyPathIgnored) {
+    FileLogger file_logger = FileLogger("");
+
+    file_logger.saveLog(Log(1, "dropped"));
+    file_logger.flush();
+
+    EXPECT_EQ("", file_logger.getFilePath());
+    EXPECT_EQ(0u, file_logger.getWrittenBytes());
+}
+
+
+TEST(SaveLog, writtenBytesAreCounted) {
+    string path = "file_logger_written_bytes.log";
+    remove(path.c_str());
+    FileLogger file_logger = FileLogger(path);
+    EXPECT_EQ(0u, file_logger.getWrittenBytes());
+
+    file_logger.saveLog(Log(10, "first"));
+    file_logger.saveMessage("second");
+    file_logger.flush();
+
+    EXPECT_EQ(readFile(path).size(), file_logger.getWrittenBytes());
+    EXPECT_EQ(file_logger.getWrittenBytes(), FileLogger(file_logger).getWrittenBytes());
+    remove(path.c_str());
+}
+
+
+TEST(SaveEvent, textFormatMatchesStringLogs) {
+    string path = "file_logger_event_text.log";
+    remove(path.c_str());
+    FileLogger file_logger = FileLogger(path);
+
+    file_logger.saveEvent(LogEvent::createRotation(4, 90));
+    file_logger.saveEvent(LogEvent::createCurrentPosition(1.0, 2.0));
+    file_logger.flush();
+
+    EXPECT_EQ("Time: 4: Rotated: 90 degrees.\nCurrent position: (1.000000, 2.000000)\n", readFile(path));
+    remove(path.c_str());
+}
+
+
+TEST(SaveEvent, binaryFormatDecodesToTextLogs) {
+    string path = "file_logger_event_binary.log";
+    remove(path.c_str());
+    {
+        FileLogger file_logger = FileLogger(path, FlushPolicy(), LogFileFormat::BINARY);
+        EXPECT_EQ(LogFileFormat::BINARY, file_logger.getFormat());
+
+        file_logger.saveEvent(LogEvent::createMowingOption(3, true));
+        file_logger.saveLog(Log(4, "Point added"));
+        file_logger.saveEvent(LogEvent::createMovement(5, 1.0, 0.0, 0.0));
+    }
+
+    string content = readFile(path);
+    ASSERT_EQ(sizeof(LogEvent::BINARY_LOG_HEADER) + 3 * LogEvent::RECORD_SIZE + string("Point added").size(), 
+        content.size());
+
+    istringstream input(content.substr(sizeof(LogEvent::BINARY_LOG_HEADER)));
+    LogEvent event;
+    string text;
+    string lines;
+    while (LogEvent::readRecord(input, event, text)) {
+        lines += (event.type_ == LogEventType::TEXT ? LogEvent::formatLine(event.time_, event.has_time_, text) 
+            : event.formatLine()) + "\n";
+    }
+
+    EXPECT_EQ("Time: 3: Mowing mode: on\nTime: 4: Point added\n"
+        "Time: 5: Distance moved: 1.000000from point x: 0.000000, y: 0.000000\n", lines);
+    remove(path.c_str());
+}
+
+
+TEST(SaveLog, loggersOfOneFileShareWriter) {
+    string path = "file_logger_shared.log";
+    remove(path.c_str());
+    {
+        FileLogger first_logger = FileLogger(path, FlushPolicy(), LogFileFormat::BINARY);
+        auto work = [&path](const FileLogger* logger) {
+            FileLogger own_logger = logger ? *logger : FileLogger("./" + path, FlushPolicy(), LogFileFormat::BINARY);
+            for (u_int64_t i = 0; i < 5000; ++i) {
+                own_logger.saveEvent(LogEvent::createMovement(i, 1.0, 0.0, 0.0));
+            }
+        };
+        thread first(work, &first_logger);
+        thread second(work, nullptr);
+        first.join();
+        second.join();
+    }
+
+    string content = readFile(path);
+    ASSERT_EQ(sizeof(LogEvent::BINARY_LOG_HEADER) + 10000 * LogEvent::RECORD_SIZE, content.size());
+    EXPECT_EQ(0, content.compare(0, sizeof(LogEvent::BINARY_LOG_HEADER), LogEvent::BINARY_LOG_HEADER, 
+        sizeof(LogEvent::BINARY_LOG_HEADER)));
+    remove(path.c_str());
+}
@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+#include "../include/LatencyHistogram.h"
+
+using namespace std;
+
+TEST(LatencyHistogramTest, emptyHistogram) {
+    LatencyHistogram histogram;
+
+    EXPECT_EQ(0u, histogram.getCount());
+    EXPECT_EQ(0u, histogram.getMax());
+    EXPECT_DOUBLE_EQ(0.0, histogram.getMean());
+    EXPECT_EQ(0u, histogram.getPercentile(99.0));
+}
+
+TEST(LatencyHistogramTest, calculateBucket) {
+    EXPECT_EQ(0u, LatencyHistogram::calculateBucket(0));
+    EXPECT_EQ(1u, LatencyHistogram::calculateBucket(1));
+    EXPECT_EQ(2u, LatencyHistogram::calculateBucket(3));
+    EXPECT_EQ(11u, LatencyHistogram::calculateBucket(1024));
+    EXPECT_EQ(LatencyHistogram::BUCKETS_NUMBER - 1, LatencyHistogram::calculateBucket(UINT64_MAX));
+    EXPECT_EQ(1023u, LatencyHistogram::getBucketUpperBound(10));
+}
+
+TEST(LatencyHistogramTest, recordUpdatesStatistics) {
+    LatencyHistogram histogram;
+
+    for (int i = 0; i < 99; ++i) {
+        histogram.record(100);
+    }
+    histogram.record(5000);
+
+    EXPECT_EQ(100u, histogram.getCount());
+    EXPECT_EQ(5000u, histogram.getMax());
+    EXPECT_DOUBLE_EQ(149.0, histogram.getMean());
+    EXPECT_EQ(99u, histogram.getBucketCount(7));
+    EXPECT_EQ(127u, histogram.getPercentile(50.0));
+    EXPECT_EQ(8191u, histogram.getPercentile(100.0));
+}
+
+TEST(LatencyHistogramTest, resetClearsStatistics) {
+    LatencyHistogram histogram;
+    histogram.record(100);
+
+    histogram.reset();
+
+    EXPECT_EQ(0u, histogram.getCount());
+    EXPECT_EQ(0u, histogram.getBucketCount(7));
+}
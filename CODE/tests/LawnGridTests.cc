@@ -0,0 +1,246 @@
+/*
+    Author: Maciej Cieslik
+
+    Tests LawnGrid class methods.
+*/
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+#include "../include/LawnGrid.h"
+
+using namespace std;
+
+
+TEST(ConstructorAndGetters, constructorAndGetters) {
+    unsigned int columns_number = 1000;
+    unsigned int rows_number = 130;
+    LawnGrid grid = LawnGrid(columns_number, rows_number);
+
+    EXPECT_EQ(columns_number, grid.getColumnsNumber());
+    EXPECT_EQ(rows_number, grid.getRowsNumber());
+    EXPECT_EQ(16u, grid.getHorizontalTilesNumber());
+    EXPECT_EQ(3u, grid.getVerticalTilesNumber());
+    EXPECT_FALSE(grid.isEmpty());
+    EXPECT_EQ(0u, grid.countSetFields());
+}
+
+
+TEST(ConstructorAndGetters, defaultConstructorEmpty) {
+    LawnGrid grid = LawnGrid();
+
+    EXPECT_TRUE(grid.isEmpty());
+    EXPECT_EQ(0u, grid.countSetFields());
+}
+
+
+TEST(OperatorEquals, equals) {
+    LawnGrid grid = LawnGrid(100, 100);
+    LawnGrid grid2 = LawnGrid(100, 100);
+    grid.setField(70, 3);
+    grid2.setField(70, 3);
+
+    EXPECT_TRUE(grid == grid2);
+    EXPECT_FALSE(grid != grid2);
+}
+
+
+TEST(OperatorEquals, notEqualsFields) {
+    LawnGrid grid = LawnGrid(100, 100);
+    LawnGrid grid2 = LawnGrid(100, 100);
+    grid2.setField(99, 99);
+
+    EXPECT_FALSE(grid == grid2);
+    EXPECT_TRUE(grid != grid2);
+}
+
+
+TEST(OperatorEquals, notEqualsSize) {
+    LawnGrid grid = LawnGrid(100, 100);
+    LawnGrid grid2 = LawnGrid(101, 100);
+
+    EXPECT_FALSE(grid == grid2);
+}
+
+
+TEST(SetField, setFieldInsideGrid) {
+    LawnGrid grid = LawnGrid(200, 200);
+
+    grid.setField(130, 65);
+
+    EXPECT_TRUE(grid.getField(130, 65));
+    EXPECT_FALSE(grid.getField(129, 65));
+    EXPECT_FALSE(grid.getField(130, 64));
+    EXPECT_EQ(1u, grid.countSetFields());
+}
+
+
+TEST(SetField, setFieldOutsideGridIgnored) {
+    LawnGrid grid = LawnGrid(100, 100);
+
+    grid.setField(100, 5);
+    grid.setField(5, 100);
+
+    EXPECT_EQ(0u, grid.countSetFields());
+    EXPECT_FALSE(grid.getField(100, 5));
+}
+
+
+TEST(SetField, setFieldTwiceCountedOnce) {
+    LawnGrid grid = LawnGrid(100, 100);
+
+    grid.setField(10, 10);
+    grid.setField(10, 10);
+
+    EXPECT_EQ(1u, grid.countSetFields());
+}
+
+
+TEST(SetFieldsInRow, setFieldsAcrossTiles) {
+    LawnGrid grid = LawnGrid(300, 10);
+
+    grid.setFieldsInRow(4, 60, 200);
+
+    EXPECT_EQ(141u, grid.countSetFields());
+    EXPECT_FALSE(grid.getField(59, 4));
+    EXPECT_TRUE(grid.getField(60, 4));
+    EXPECT_TRUE(grid.getField(128, 4));
+    EXPECT_TRUE(grid.getField(200, 4));
+    EXPECT_FALSE(grid.getField(201, 4));
+    EXPECT_FALSE(grid.getField(100, 3));
+}
+
+
+TEST(SetFieldsInRow, setFieldsClippedToGrid) {
+    LawnGrid grid = LawnGrid(70, 10);
+
+    grid.setFieldsInRow(9, 0, 1000);
+    grid.setFieldsInRow(10, 0, 1000);
+
+    EXPECT_EQ(70u, grid.countSetFields());
+}
+
+
+TEST(SetFieldsInRow, setFieldsWholeTile) {
+    LawnGrid grid = LawnGrid(128, 1);
+
+    grid.setFieldsInRow(0, 64, 127);
+
+    EXPECT_EQ(0u, grid.getTileRow(0, 0));
+    EXPECT_EQ(~uint64_t(0), grid.getTileRow(1, 0));
+}
+
+
+TEST(ToFields, toFieldsMatchesGrid) {
+    LawnGrid grid = LawnGrid(3, 2);
+    vector<vector<bool>> pattern = {{false, true, false}, {false, false, true}};
+
+    grid.setField(1, 0);
+    grid.setField(2, 1);
+
+    EXPECT_EQ(pattern, grid.toFields());
+}
+
+
+TEST(CountSetFields, countUpdatedOnlyForNewFields) {
+    LawnGrid grid = LawnGrid(300, 300);
+
+    grid.setFieldsInRow(10, 0, 99);
+    grid.setFieldsInRow(10, 50, 149);
+    grid.setField(120, 10);
+    grid.setField(120, 11);
+
+    EXPECT_EQ(151u, grid.countSetFields());
+}
+
+
+TEST(CountSetFieldsInTile, countPerTile) {
+    LawnGrid grid = LawnGrid(300, 300);
+
+    grid.setFieldsInRow(70, 60, 130);
+
+    EXPECT_EQ(4u, grid.countSetFieldsInTile(0, 1));
+    EXPECT_EQ(64u, grid.countSetFieldsInTile(1, 1));
+    EXPECT_EQ(3u, grid.countSetFieldsInTile(2, 1));
+    EXPECT_EQ(0u, grid.countSetFieldsInTile(1, 0));
+}
+
+
+TEST(CountSetFieldsInArea, countWholeAndPartialTiles) {
+    LawnGrid grid = LawnGrid(300, 300);
+    for (unsigned int row = 0; row < 300; ++row) {
+        grid.setFieldsInRow(row, 0, 299);
+    }
+
+    EXPECT_EQ(90000u, grid.countSetFieldsInArea(0, 0, 299, 299));
+    EXPECT_EQ(128u * 128u, grid.countSetFieldsInArea(64, 64, 191, 191));
+    EXPECT_EQ(11u * 21u, grid.countSetFieldsInArea(60, 100, 70, 120));
+    EXPECT_EQ(1u, grid.countSetFieldsInArea(5, 5, 5, 5));
+}
+
+
+TEST(CountSetFieldsInArea, countClippedToGrid) {
+    LawnGrid grid = LawnGrid(100, 100);
+    grid.setField(99, 99);
+    grid.setField(0, 0);
+
+    EXPECT_EQ(1u, grid.countSetFieldsInArea(50, 50, 1000, 1000));
+    EXPECT_EQ(0u, grid.countSetFieldsInArea(100, 0, 1000, 1000));
+    EXPECT_EQ(0u, grid.countSetFieldsInArea(10, 10, 5, 5));
+}
+
+
+TEST(CopyOnWrite, copySharesTiles) {
+    LawnGrid grid = LawnGrid(200, 200);
+    grid.setField(10, 10);
+
+    LawnGrid copy = grid;
+
+    EXPECT_TRUE(grid == copy);
+    EXPECT_TRUE(copy.hasSameTile(grid, 0, 0));
+    EXPECT_TRUE(copy.hasSameTile(grid, 3, 3));
+}
+
+
+TEST(CopyOnWrite, writeDoesNotChangeCopy) {
+    LawnGrid grid = LawnGrid(200, 200);
+    grid.setField(10, 10);
+    LawnGrid copy = grid;
+
+    grid.setField(11, 10);
+    grid.setFieldsInRow(150, 0, 199);
+
+    EXPECT_TRUE(grid.getField(11, 10));
+    EXPECT_FALSE(copy.getField(11, 10));
+    EXPECT_TRUE(copy.getField(10, 10));
+    EXPECT_EQ(202u, grid.countSetFields());
+    EXPECT_EQ(1u, copy.countSetFields());
+    EXPECT_EQ(0u, copy.countSetFieldsInTile(0, 2));
+    EXPECT_FALSE(copy.hasSameTile(grid, 0, 0));
+    EXPECT_FALSE(copy.hasSameTile(grid, 3, 2));
+    EXPECT_TRUE(copy.hasSameTile(grid, 1, 1));
+}
+
+
+TEST(CopyOnWrite, writeAlreadyMowedFieldKeepsTileShared) {
+    LawnGrid grid = LawnGrid(100, 100);
+    grid.setField(5, 5);
+    LawnGrid copy = grid;
+
+    grid.setField(5, 5);
+
+    EXPECT_TRUE(copy.hasSameTile(grid, 0, 0));
+}
+
+
+TEST(CopyOnWrite, emptyTilesOfNewGridIndependent) {
+    LawnGrid grid = LawnGrid(200, 200);
+
+    grid.setField(0, 0);
+
+    EXPECT_TRUE(grid.getField(0, 0));
+    EXPECT_FALSE(grid.getField(64, 0));
+    EXPECT_FALSE(grid.getField(0, 64));
+    EXPECT_EQ(1u, grid.countSetFieldsInTile(0, 0));
+    EXPECT_EQ(0u, grid.countSetFieldsInTile(1, 0));
+}
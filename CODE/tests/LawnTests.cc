@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 #include <cmath>
 #include <cstdint>
+#include <random>
 #include "../include/Lawn.h"
 #include "../include/Constants.h"
 #include "../include/Config.h"
@@ -17,9 +18,9 @@ using namespace std;
 TEST(Getters, Getters) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    std::vector<std::vector<bool>> lawn_fields (Config::VERTICAL_FIELDS_NUMBER, 
-        std::vector<bool>(Config::HORIZONTAL_FIELDS_NUMBER, false));
+    Config config(lawn_width, lawn_length);
+    std::vector<std::vector<bool>> lawn_fields (config.getVerticalFieldsNumber(), 
+        std::vector<bool>(config.getHorizontalFieldsNumber(), false));
     Lawn lawn = Lawn(lawn_width, lawn_length);
 
     unsigned int width = lawn.getWidth();
@@ -32,10 +33,25 @@ TEST(Getters, Getters) {
 }
 
 
+
+TEST(Getters, lawnsOfDifferentSizesAreIndependent) {
+    Lawn small_lawn = Lawn(100, 100);
+    Lawn big_lawn = Lawn(5000, 6000);
+
+    small_lawn.cutGrass(pair<double, double>(50.0, 50.0), 20);
+    big_lawn.cutGrass(pair<double, double>(2500.0, 3000.0), 100);
+
+    EXPECT_NEAR(0.1, small_lawn.getFieldWidth(), 1e-9);
+    EXPECT_NEAR(5.0, big_lawn.getFieldWidth(), 1e-9);
+    EXPECT_EQ(500u, small_lawn.calculateFieldIndexes(50.0, 50.0).second);
+    EXPECT_EQ(600u, big_lawn.calculateFieldIndexes(2500.0, 3000.0).second);
+    EXPECT_NEAR(Constants::PI * 10.0 * 10.0 / 10000.0, small_lawn.calculateShavedArea(), 0.002);
+    EXPECT_NEAR(Constants::PI * 50.0 * 50.0 / 30000000.0, big_lawn.calculateShavedArea(), 0.0001);
+}
+
 TEST(OperatorEquals, equals) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width, lawn_length);
 
@@ -47,7 +63,6 @@ TEST(OperatorEquals, equals) {
 TEST(OperatorEquals, notEqualsLawnWidth) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width + 1, lawn_length);
 
@@ -59,7 +74,6 @@ TEST(OperatorEquals, notEqualsLawnWidth) {
 TEST(OperatorEquals, notEqualsLawnLength) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width, lawn_length + 1);
 
@@ -71,7 +85,6 @@ TEST(OperatorEquals, notEqualsLawnLength) {
 TEST(OperatorEquals, notEqualsFields) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width, lawn_length);
     lawn2.cutGrassOnField(std::pair<unsigned int, unsigned int>(1, 1));
@@ -84,7 +97,6 @@ TEST(OperatorEquals, notEqualsFields) {
 TEST(OperatorNotEquals, OperatorEquals_notEqualsLawnWidth_Test) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width + 1, lawn_length);
 
@@ -96,7 +108,6 @@ TEST(OperatorNotEquals, OperatorEquals_notEqualsLawnWidth_Test) {
 TEST(OperatorNotEquals, equals) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width, lawn_length);
 
@@ -108,7 +119,6 @@ TEST(OperatorNotEquals, equals) {
 TEST(IsPointInLawn, isPointInLawnCorrect) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 0.5;
     double y = 0.3;
@@ -121,7 +131,6 @@ TEST(IsPointInLawn, isPointInLawnCorrect) {
 TEST(IsPointInLawn, isPointInLawnCorrectMinimalValues) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 0.0;
     double y = 0.0;
@@ -135,7 +144,6 @@ TEST(IsPointInLawn, isPointInLawnCorrectMinimalValues) {
 TEST(IsPointInLawn, isPointInLawnCorrectMaximalValues) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 10000.0;
     double y = 10000.0;
@@ -149,7 +157,6 @@ TEST(IsPointInLawn, isPointInLawnCorrectMaximalValues) {
 TEST(IsPointInLawn, isPointInLawnIncorrectSquareLawn) {
     unsigned int lawn_width = 6000;
     unsigned int lawn_length = 6000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 6000.1;
     double y = 5000.1;
@@ -163,7 +170,6 @@ TEST(IsPointInLawn, isPointInLawnIncorrectSquareLawn) {
 TEST(IsPointInLawn, isPointInLawnIncorrectRectangularLawn) {
     unsigned int lawn_width = 60000;
     unsigned int lawn_length = 6000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 50000.1;
     double y = 6000.1;
@@ -177,7 +183,6 @@ TEST(IsPointInLawn, isPointInLawnIncorrectRectangularLawn) {
 TEST(CalculateFieldIndexes, calculateFieldIndexesLeftDownCornerMinimalLawn) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 0.0;
     double y = 0.0;
@@ -193,7 +198,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesLeftDownCornerMinimalLawn) {
 TEST(CalculateFieldIndexes, calculateFieldIndexesRightUpCornerMinimalLawn) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 99.999;
     double y = 99.999;
@@ -208,7 +212,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesRightUpCornerMinimalLawn) {
 TEST(CalculateFieldIndexes, calculateFieldIndexesLeftDownCornerMaximalLawn) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 0.0;
     double y = 0.0;
@@ -224,7 +227,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesLeftDownCornerMaximalLawn) {
 TEST(CalculateFieldIndexes, calculateFieldIndexesRightUpCornerMaximalLawn) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 9999.999;
     double y = 9999.999;
@@ -239,7 +241,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesRightUpCornerMaximalLawn) {
 TEST(CalculateFieldIndexes, calculateFieldIndexesRightUpCornerMaxRatioLawn) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 1000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 9999.999;
     double y = 999.999;
@@ -254,7 +255,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesRightUpCornerMaxRatioLawn) {
 TEST(CalculateFieldIndexes, calculateFieldIndexesMiddleMinimalLawn) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 50.0;
     double y = 50.0;
@@ -269,7 +269,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesMiddleMinimalLawn) {
 TEST(CalculateFieldIndexes, calculateFieldIndexesCustomValuesCustomLawnMaxRatio) {
     unsigned int lawn_width = 60000;
     unsigned int lawn_length = 6000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 15789.2;
     double y = 5799.8;
@@ -284,7 +283,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesCustomValuesCustomLawnMaxRatio)
 TEST(CalculateFieldIndexes, calculateFieldIndexesCustomValuesCustomLawnMaxRatio2) {
     unsigned int lawn_width = 60010;
     unsigned int lawn_length = 6010;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 15782.2;
     double y = 5792.8;
@@ -299,7 +297,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesCustomValuesCustomLawnMaxRatio2
 TEST(CalculateFieldIndexes, calculateFieldIndexesCustomValuesCustomLawnCustomRatio) {
     unsigned int lawn_width = 41210;
     unsigned int lawn_length = 6410;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double x = 15782.2;
     double y = 5792.8;
@@ -314,7 +311,6 @@ TEST(CalculateFieldIndexes, calculateFieldIndexesCustomValuesCustomLawnCustomRat
 TEST(CutGrassOnFields, cutGrassOnField) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<unsigned int, unsigned int> indexes (151, 3);
 
@@ -327,7 +323,6 @@ TEST(CutGrassOnFields, cutGrassOnField) {
 TEST(CalculateShavedArea, calculateShavedAreaCustom) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<unsigned int, unsigned int> indexes1 (151, 3);
     pair<unsigned int, unsigned int> indexes2 (152, 3);
@@ -359,7 +354,6 @@ TEST(CalculateShavedArea, calculateShavedAreaCustom) {
 TEST(CalculateShavedArea, calculateShavedAreaNotShaved) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     double shavedFactor = 0.0;
 
@@ -367,16 +361,46 @@ TEST(CalculateShavedArea, calculateShavedAreaNotShaved) {
 }
 
 
+TEST(CalculateShavedArea, calculateShavedAreaRegion) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> left_down_corner (0.0, 0.0);
+    pair<double, double> right_up_corner (9.99, 9.99);
+
+    for (unsigned int row = 0; row < 50; ++row) {
+        for (unsigned int column = 0; column < 100; ++column) {
+            lawn.cutGrassOnField(pair<unsigned int, unsigned int>(column, row));
+        }
+    }
+
+    EXPECT_DOUBLE_EQ(0.5, lawn.calculateShavedArea(left_down_corner, right_up_corner));
+    EXPECT_DOUBLE_EQ(0.005, lawn.calculateShavedArea());
+}
+
+
+TEST(CalculateShavedArea, calculateShavedAreaRegionOutsideLawn) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> left_down_corner (200.0, 200.0);
+    pair<double, double> right_up_corner (300.0, 300.0);
+    lawn.cutGrassOnField(pair<unsigned int, unsigned int>(999, 999));
+
+    EXPECT_DOUBLE_EQ(0.0, lawn.calculateShavedArea(left_down_corner, right_up_corner));
+}
+
+
 TEST(CutGrass, cutGrassFullCircleIntBladeMiddleMinLawn) {
     unsigned int lawn_width = 100;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (50, 50);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;;
-    double max_radius = blade_diameter / 2 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 10;
+    double max_radius = blade_diameter / 2 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2 - config.getFieldWidth(); 
     double min_area = Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -391,13 +415,13 @@ TEST(CutGrass, cutGrassFullCircleIntBladeMiddleMinLawn) {
 TEST(CutGrass, cutGrassFullCircleMaxLawn) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (50, 50);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -412,13 +436,13 @@ TEST(CutGrass, cutGrassFullCircleMaxLawn) {
 TEST(CutGrass, cutGrassMaxLawnDownSide) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (50, 0);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.5 * Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -433,13 +457,13 @@ TEST(CutGrass, cutGrassMaxLawnDownSide) {
 TEST(CutGrass, cutGrassMaxLawnUpSide) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (50, 10000);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.5 * Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -454,13 +478,13 @@ TEST(CutGrass, cutGrassMaxLawnUpSide) {
 TEST(CutGrass, cutGrassMaxLawnLeftSide) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (0, 50);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.5 * Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -475,13 +499,13 @@ TEST(CutGrass, cutGrassMaxLawnLeftSide) {
 TEST(CutGrass, cutGrassMaxLawnRigthSide) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (10000, 50);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.5 * Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -496,13 +520,13 @@ TEST(CutGrass, cutGrassMaxLawnRigthSide) {
 TEST(CutGrass, cutGrassMaxLawnLeftDownCorner) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (0, 0);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.25 * Constants::PI * min_radius * min_radius;
     
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -517,13 +541,13 @@ TEST(CutGrass, cutGrassMaxLawnLeftDownCorner) {
 TEST(CutGrass, cutGrassMaxLawnRightDownCorner) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (10000, 0);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.25 * Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -538,13 +562,13 @@ TEST(CutGrass, cutGrassMaxLawnRightDownCorner) {
 TEST(CutGrass, cutGrassLawnRightUpCorner) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (10000, 10000);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.25 * Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -559,13 +583,13 @@ TEST(CutGrass, cutGrassLawnRightUpCorner) {
 TEST(CutGrass, cutGrassMaxLawnLeftUpCorner) {
     unsigned int lawn_width = 10000;
     unsigned int lawn_length = 10000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
+    Config config(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (0, 10000);
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;
-    double max_radius = blade_diameter / 2.0 + Config::FIELD_WIDTH; 
+    unsigned int blade_diameter = 100;
+    double max_radius = blade_diameter / 2.0 + config.getFieldWidth(); 
     double max_area = Constants::PI * max_radius * max_radius;
-    double min_radius = blade_diameter / 2.0 - Config::FIELD_WIDTH; 
+    double min_radius = blade_diameter / 2.0 - config.getFieldWidth(); 
     double min_area = 0.25 * Constants::PI * min_radius * min_radius;
 
     lawn.cutGrass(blade_middle, blade_diameter);
@@ -580,14 +604,12 @@ TEST(CutGrass, cutGrassMaxLawnLeftUpCorner) {
 TEST(cutGrassSection, cutTitledAreaAllInside) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (250, 250);
     pair<double, double> ending_point (750, 750);
-    unsigned short angle = 45;
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;;
+    unsigned int blade_diameter = 10;
 
-    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point, angle);
+    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point);
     unsigned int lawn_area = lawn_width * lawn_length;
     double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
     double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4 + blade_diameter * 500 * sqrt(2);
@@ -599,14 +621,12 @@ TEST(cutGrassSection, cutTitledAreaAllInside) {
 TEST(cutGrassSection, cutTitledAreaAllInsideAngle225) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (750, 750);
     pair<double, double> ending_point (250, 250);
-    unsigned short angle = 225;
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;;
+    unsigned int blade_diameter = 10;
 
-    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point, angle);
+    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point);
     unsigned int lawn_area = lawn_width * lawn_length;
     double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
     double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4 + blade_diameter * 500 * sqrt(2);
@@ -618,14 +638,12 @@ TEST(cutGrassSection, cutTitledAreaAllInsideAngle225) {
 TEST(cutGrassSection, cutNormalAreaAllInside) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (250, 250);
     pair<double, double> ending_point (250, 750);
-    unsigned short angle = 0;
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;;
+    unsigned int blade_diameter = 10;
 
-    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point, angle);
+    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point);
     unsigned int lawn_area = lawn_width * lawn_length;
     double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
     double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4 + blade_diameter * 500;
@@ -637,14 +655,12 @@ TEST(cutGrassSection, cutNormalAreaAllInside) {
 TEST(cutGrassSection, cutNormalAreaAllInside2) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (250, 250);
     pair<double, double> ending_point (750, 250);
-    unsigned short angle = 90;
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;;
+    unsigned int blade_diameter = 10;
 
-    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point, angle);
+    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point);
     unsigned int lawn_area = lawn_width * lawn_length;
     double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
     double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4 + blade_diameter * 500;
@@ -655,14 +671,12 @@ TEST(cutGrassSection, cutNormalAreaAllInside2) {
 TEST(cutGrassSection, cutNormalAreaAllInside3) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (250, 750);
     pair<double, double> ending_point (250, 250);
-    unsigned short angle = 180;
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;;
+    unsigned int blade_diameter = 10;
 
-    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point, angle);
+    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point);
     unsigned int lawn_area = lawn_width * lawn_length;
     double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
     double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4 + blade_diameter * 500;
@@ -674,14 +688,12 @@ TEST(cutGrassSection, cutNormalAreaAllInside3) {
 TEST(cutGrassSection, cutNormalAreaAllInside4) {
     unsigned int lawn_width = 1000;
     unsigned int lawn_length = 1000;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     pair<double, double> blade_middle (750, 250);
     pair<double, double> ending_point (250, 250);
-    unsigned short angle = 270;
-    unsigned int blade_diameter = Config::MIN_BLADE_DIAMETER;;
+    unsigned int blade_diameter = 10;
 
-    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point, angle);
+    lawn.cutGrassSection(blade_middle, blade_diameter, ending_point);
     unsigned int lawn_area = lawn_width * lawn_length;
     double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
     double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4 + blade_diameter * 500;
@@ -690,3 +702,194 @@ TEST(cutGrassSection, cutNormalAreaAllInside4) {
 }
 
 
+
+
+TEST(DirtyRegions, cutIncreasesGeneration) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> blade_middle (50.0, 50.0);
+    unsigned int blade_diameter = 10;
+
+    lawn.cutGrass(blade_middle, blade_diameter);
+    vector<LawnRegion> regions = lawn.takeDirtyRegionsSince(0);
+
+    EXPECT_EQ(1u, lawn.getGeneration());
+    ASSERT_EQ(1u, regions.size());
+    EXPECT_EQ(450u, regions[0].first_column_);
+    EXPECT_EQ(450u, regions[0].first_row_);
+    EXPECT_EQ(550u, regions[0].last_column_);
+    EXPECT_EQ(550u, regions[0].last_row_);
+    EXPECT_TRUE(lawn.takeDirtyRegionsSince(1).empty());
+}
+
+
+TEST(DirtyRegions, cutWithoutChangeKeepsGeneration) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    pair<double, double> blade_middle (50.0, 50.0);
+    unsigned int blade_diameter = 10;
+
+    lawn.cutGrass(blade_middle, blade_diameter);
+    lawn.cutGrass(blade_middle, blade_diameter);
+    lawn.cutGrassOnField(pair<unsigned int, unsigned int>(500, 500));
+
+    EXPECT_EQ(1u, lawn.getGeneration());
+}
+
+
+TEST(DirtyRegions, regionsSinceGeneration) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+
+    lawn.cutGrassOnField(pair<unsigned int, unsigned int>(10, 10));
+    lawn.cutGrassOnField(pair<unsigned int, unsigned int>(900, 900));
+    vector<LawnRegion> all_regions = lawn.takeDirtyRegionsSince(0);
+    vector<LawnRegion> new_regions = lawn.takeDirtyRegionsSince(1);
+
+    EXPECT_EQ(2u, lawn.getGeneration());
+    EXPECT_EQ(2u, all_regions.size());
+    ASSERT_EQ(1u, new_regions.size());
+    EXPECT_EQ(900u, new_regions[0].first_column_);
+    EXPECT_EQ(900u, new_regions[0].last_row_);
+}
+
+
+TEST(DirtyRegions, neighbouringRegionsMerged) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+
+    lawn.cutGrassOnField(pair<unsigned int, unsigned int>(10, 10));
+    lawn.cutGrassOnField(pair<unsigned int, unsigned int>(11, 10));
+    vector<LawnRegion> regions = lawn.takeDirtyRegionsSince(1);
+
+    EXPECT_EQ(2u, lawn.getGeneration());
+    ASSERT_EQ(1u, regions.size());
+    EXPECT_EQ(10u, regions[0].first_column_);
+    EXPECT_EQ(11u, regions[0].last_column_);
+}
+
+
+TEST(DirtyRegions, oldGenerationReturnsWholeLawn) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+
+    for (unsigned int i = 0; i < 2000; ++i) {
+        lawn.cutGrassOnField(pair<unsigned int, unsigned int>((2 * i) % 1000, 2 * (2 * i / 1000)));
+    }
+    vector<LawnRegion> old_regions = lawn.takeDirtyRegionsSince(0);
+    vector<LawnRegion> new_regions = lawn.takeDirtyRegionsSince(1999);
+
+    EXPECT_EQ(2000u, lawn.getGeneration());
+    ASSERT_EQ(1u, old_regions.size());
+    EXPECT_EQ(0u, old_regions[0].first_column_);
+    EXPECT_EQ(999u, old_regions[0].last_column_);
+    EXPECT_EQ(999u, old_regions[0].last_row_);
+    EXPECT_EQ(1u, new_regions.size());
+}
+
+
+TEST(CutGrassAlongPath, cutCapsuleArea) {
+    unsigned int lawn_width = 1000;
+    unsigned int lawn_length = 1000;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    unsigned int blade_diameter = 40;
+    vector<pair<double, double>> path = {{300.0, 300.0}, {600.0, 700.0}};
+
+    lawn.cutGrassAlongPath(path, blade_diameter);
+    unsigned int lawn_area = lawn_width * lawn_length;
+    double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
+    double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4 + blade_diameter * 500;
+
+    EXPECT_NEAR(shaved_area, estimated_shaved_area, 0.01 * estimated_shaved_area);
+    EXPECT_EQ(1u, lawn.getGeneration());
+}
+
+
+TEST(CutGrassAlongPath, cutSinglePointAsCircle) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    unsigned int blade_diameter = 10;
+    vector<pair<double, double>> path = {{50.0, 50.0}};
+
+    lawn.cutGrassAlongPath(path, blade_diameter);
+    unsigned int lawn_area = lawn_width * lawn_length;
+    double shaved_area = lawn.calculateShavedArea() * static_cast<double>(lawn_area);
+    double estimated_shaved_area = Constants::PI * blade_diameter * blade_diameter / 4;
+
+    EXPECT_NEAR(shaved_area, estimated_shaved_area, 0.01 * estimated_shaved_area);
+}
+
+
+TEST(CutGrassAlongPath, cutPolylineSameAsSections) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn path_lawn = Lawn(lawn_width, lawn_length);
+    Lawn sections_lawn = Lawn(lawn_width, lawn_length);
+    unsigned int blade_diameter = 10;
+    vector<pair<double, double>> path = {{10.0, 10.0}, {60.0, 10.0}, {60.0, 70.0}, {95.0, 98.0}};
+
+    path_lawn.cutGrassAlongPath(path, blade_diameter);
+    for (size_t i = 0; i + 1 < path.size(); ++i) {
+        sections_lawn.cutGrassSection(path[i], blade_diameter, path[i + 1]);
+    }
+
+    EXPECT_TRUE(path_lawn.getGrid() == sections_lawn.getGrid());
+    EXPECT_EQ(1u, path_lawn.getGeneration());
+}
+
+
+TEST(CutGrassAlongPath, cutEmptyPath) {
+    unsigned int lawn_width = 100;
+    unsigned int lawn_length = 100;
+    Lawn lawn = Lawn(lawn_width, lawn_length);
+    vector<pair<double, double>> path;
+
+    lawn.cutGrassAlongPath(path, 10);
+
+    EXPECT_DOUBLE_EQ(0.0, lawn.calculateShavedArea());
+}
+
+
+TEST(CutGrass, cutGrassSameAsFieldByFieldRule) {
+    // Field is mowed if it has 3 corners in range of blade or 2 corners and its middle in range of blade
+    unsigned int lawn_width = 300;
+    unsigned int lawn_length = 200;
+    Config config(lawn_width, lawn_length);
+    mt19937 generator(3);
+    uniform_real_distribution<double> x_distribution(-10.0, lawn_width + 10.0);
+    uniform_real_distribution<double> y_distribution(-10.0, lawn_length + 10.0);
+    uniform_int_distribution<unsigned int> diameter_distribution(10, 20);
+    double width = config.getFieldWidth();
+
+    for (unsigned int i = 0; i < 50; ++i) {
+        Lawn lawn = Lawn(lawn_width, lawn_length);
+        pair<double, double> blade_middle (x_distribution(generator), y_distribution(generator));
+        unsigned int blade_diameter = diameter_distribution(generator);
+        double radius = blade_diameter / 2.0;
+
+        lawn.cutGrass(blade_middle, blade_diameter);
+
+        auto isInCircle = [&](double x, double y) {
+            double dx = x - blade_middle.first;
+            double dy = y - blade_middle.second;
+            return dx * dx + dy * dy <= radius * radius;
+        };
+        const LawnGrid& grid = lawn.getGrid();
+        for (unsigned int row = 0; row < grid.getRowsNumber(); ++row) {
+            for (unsigned int column = 0; column < grid.getColumnsNumber(); ++column) {
+                unsigned int corners = isInCircle(column * width, row * width) + 
+                    isInCircle((column + 1) * width, row * width) + isInCircle(column * width, (row + 1) * width) + 
+                    isInCircle((column + 1) * width, (row + 1) * width);
+                bool expected = corners > 2 || 
+                    (corners == 2 && isInCircle((column + 0.5) * width, (row + 0.5) * width));
+                ASSERT_EQ(expected, grid.getField(column, row)) << "column " << column << ", row " << row;
+            }
+        }
+    }
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include "../include/Exceptions.h"
+#include "../include/LogEvent.h"
+
+using namespace std;
+
+
+TEST(FormatLine, movementMatchesTextLog) {
+    LogEvent event = LogEvent::createMovement(120, 2.5, 1.0, 3.0);
+
+    EXPECT_EQ("Time: 120: Distance moved: 2.500000from point x: 1.000000, y: 3.000000", event.formatLine());
+    EXPECT_FALSE(event.isError());
+}
+
+
+TEST(FormatLine, rotationAndMowingMatchTextLog) {
+    EXPECT_EQ("Time: 5: Rotated: -90 degrees.", LogEvent::createRotation(5, -90).formatLine());
+    EXPECT_EQ("Time: 7: Mowing mode: on", LogEvent::createMowingOption(7, true).formatLine());
+    EXPECT_EQ("Time: 8: Mowing mode: off", LogEvent::createMowingOption(8, false).formatLine());
+}
+
+
+TEST(FormatLine, pointEventsMatchTextLog) {
+    EXPECT_EQ("Time: 3: Moving to point with id:  4", LogEvent::createMovementToPoint(3, 4).formatLine());
+    EXPECT_EQ("Time: 3: Unable to find point in the lawn. Incorrect point's id 9",
+        LogEvent::createPointNotFound(3, 9).formatLine());
+    EXPECT_EQ("Distance to point 2: 1.500000", LogEvent::createDistanceToPoint(2, 1.5).formatLine());
+    EXPECT_EQ("Current position: (1.000000, 2.000000)", LogEvent::createCurrentPosition(1.0, 2.0).formatLine());
+}
+
+
+TEST(FormatLine, errorEvents) {
+    EXPECT_TRUE(LogEvent::createMoveOutsideLawn(1).isError());
+    EXPECT_TRUE(LogEvent::createInvalidRotation(1).isError());
+    EXPECT_TRUE(LogEvent::createPointNotFound(1, 2).isError());
+    EXPECT_TRUE(LogEvent::createDistancePointNotFound(2).isError());
+    EXPECT_FALSE(LogEvent::createMowingOption(1, true).isError());
+}
+
+
+TEST(BinaryRecord, recordHasFixedSize) {
+    string output;
+    LogEvent::createMovement(1, 2.0, 3.0, 4.0).appendRecord(output);
+    LogEvent::createCurrentPosition(1.0, 2.0).appendRecord(output);
+
+    EXPECT_EQ(2 * LogEvent::RECORD_SIZE, output.size());
+}
+
+
+TEST(BinaryRecord, readRecordDecodesEvent) {
+    string output;
+    LogEvent::createMovement(1000000000000ull, 2.25, -3.5, 4.75).appendRecord(output);
+    LogEvent::createRotation(40, -270).appendRecord(output);
+    LogEvent::createDistanceToPoint(77, 8.5).appendRecord(output);
+
+    istringstream input(output);
+    LogEvent event;
+    string text;
+
+    ASSERT_TRUE(LogEvent::readRecord(input, event, text));
+    EXPECT_EQ(LogEventType::MOVEMENT, event.type_);
+    EXPECT_EQ(1000000000000ull, event.time_);
+    EXPECT_TRUE(event.has_time_);
+    EXPECT_DOUBLE_EQ(2.25, event.distance_);
+    EXPECT_DOUBLE_EQ(-3.5, event.x_);
+    EXPECT_DOUBLE_EQ(4.75, event.y_);
+
+    ASSERT_TRUE(LogEvent::readRecord(input, event, text));
+    EXPECT_EQ(LogEventType::ROTATION, event.type_);
+    EXPECT_EQ(-270, event.angle_);
+
+    ASSERT_TRUE(LogEvent::readRecord(input, event, text));
+    EXPECT_EQ(LogEventType::DISTANCE_TO_POINT, event.type_);
+    EXPECT_FALSE(event.has_time_);
+    EXPECT_EQ(77u, event.point_id_);
+    EXPECT_EQ("Distance to point 77: 8.500000", event.formatLine());
+
+    EXPECT_FALSE(LogEvent::readRecord(input, event, text));
+}
+
+
+TEST(BinaryRecord, textRecordKeepsText) {
+    string output;
+    LogEvent::appendTextRecord(output, 15, true, false, "Point added");
+    LogEvent::appendTextRecord(output, 0, false, false, "");
+    LogEvent::createMowingOption(16, true).appendRecord(output);
+
+    istringstream input(output);
+    LogEvent event;
+    string text;
+
+    ASSERT_TRUE(LogEvent::readRecord(input, event, text));
+    EXPECT_EQ(LogEventType::TEXT, event.type_);
+    EXPECT_EQ("Time: 15: Point added", LogEvent::formatLine(event.time_, event.has_time_, text));
+
+    ASSERT_TRUE(LogEvent::readRecord(input, event, text));
+    EXPECT_EQ(LogEventType::TEXT, event.type_);
+    EXPECT_EQ("", text);
+
+    ASSERT_TRUE(LogEvent::readRecord(input, event, text));
+    EXPECT_EQ("Time: 16: Mowing mode: on", event.formatLine());
+}
+
+
+TEST(BinaryRecord, truncatedRecordIsNotRead) {
+    string output;
+    LogEvent::createMovement(1, 2.0, 3.0, 4.0).appendRecord(output);
+    output.resize(LogEvent::RECORD_SIZE - 1);
+
+    istringstream input(output);
+    LogEvent event;
+    string text;
+
+    EXPECT_FALSE(LogEvent::readRecord(input, event, text));
+}
+
+
+TEST(BinaryRecord, unknownTypeIsCorrupt) {
+    string output;
+    LogEvent::createMovement(1, 2.0, 3.0, 4.0).appendRecord(output);
+    output[0] = static_cast<char>(static_cast<uint8_t>(LogEventType::CURRENT_POSITION) + 1);
+
+    istringstream input(output);
+    LogEvent event;
+    string text;
+
+    EXPECT_THROW(LogEvent::readRecord(input, event, text), CorruptLogRecordError);
+}
+
+
+TEST(BinaryRecord, textLongerThanInputIsCorrupt) {
+    string output;
+    LogEvent::appendTextRecord(output, 1, true, false, "Point added");
+    output.resize(output.size() - 1);
+
+    istringstream input(output);
+    LogEvent event;
+    string text;
+
+    EXPECT_THROW(LogEvent::readRecord(input, event, text), CorruptLogRecordError);
+}
+
+
+TEST(BinaryRecord, textLongerThanMaximumIsCorrupt) {
+    string output;
+    LogEvent::appendTextRecord(output, 1, true, false, string(LogEvent::MAX_TEXT_LENGTH + 1, 'a'));
+
+    istringstream input(output);
+    LogEvent event;
+    string text;
+
+    EXPECT_THROW(LogEvent::readRecord(input, event, text), CorruptLogRecordError);
+}
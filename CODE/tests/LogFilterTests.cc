@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+#include "../include/LogFilter.h"
+
+using namespace std;
+
+
+TEST(ConstructorAndGetters, defaultLogsEverything) {
+    LogFilter filter;
+
+    EXPECT_EQ(LogLevel::INFO, filter.getLevel(LogCategory::MOTION));
+    EXPECT_EQ(LogLevel::INFO, filter.getLevel(LogCategory::ERRORS));
+    EXPECT_TRUE(filter.isEnabled(LogCategory::ROTATION, LogLevel::INFO));
+    EXPECT_TRUE(filter.isEnabled(LogCategory::ERRORS, LogLevel::ERROR));
+}
+
+
+TEST(ConstructorAndGetters, constructorSetsEveryCategory) {
+    LogFilter filter(LogLevel::OFF);
+
+    EXPECT_FALSE(filter.isEnabled(LogCategory::MOTION, LogLevel::ERROR));
+    EXPECT_FALSE(filter.isEnabled(LogCategory::ROTATION, LogLevel::ERROR));
+    EXPECT_FALSE(filter.isEnabled(LogCategory::POINTS, LogLevel::ERROR));
+    EXPECT_FALSE(filter.isEnabled(LogCategory::ERRORS, LogLevel::ERROR));
+}
+
+
+TEST(SetLevel, levelIsPerCategory) {
+    LogFilter filter;
+    filter.setLevel(LogCategory::MOTION, LogLevel::ERROR);
+
+    EXPECT_FALSE(filter.isEnabled(LogCategory::MOTION, LogLevel::INFO));
+    EXPECT_TRUE(filter.isEnabled(LogCategory::MOTION, LogLevel::ERROR));
+    EXPECT_TRUE(filter.isEnabled(LogCategory::POINTS, LogLevel::INFO));
+    EXPECT_NE(LogFilter(), filter);
+}
+
+
+TEST(CreateErrorsOnly, onlyErrorsEnabled) {
+    LogFilter filter = LogFilter::createErrorsOnly();
+
+    EXPECT_FALSE(filter.isEnabled(LogCategory::MOTION, LogLevel::INFO));
+    EXPECT_FALSE(filter.isEnabled(LogCategory::ROTATION, LogLevel::INFO));
+    EXPECT_FALSE(filter.isEnabled(LogCategory::POINTS, LogLevel::INFO));
+    EXPECT_TRUE(filter.isEnabled(LogCategory::ERRORS, LogLevel::ERROR));
+}
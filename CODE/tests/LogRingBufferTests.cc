@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../include/LogRingBuffer.h"
+
+using namespace std;
+
+
+TEST(Constructor, capacityRoundedToPowerOfTwo) {
+    LogRingBuffer buffer = LogRingBuffer(100);
+
+    EXPECT_EQ(128u, buffer.getCapacity());
+    EXPECT_EQ(0u, buffer.getPushedNumber());
+    EXPECT_EQ(0u, buffer.getPoppedNumber());
+}
+
+
+TEST(PushAndPop, entriesInOrder) {
+    LogRingBuffer buffer = LogRingBuffer(8);
+
+    for (u_int64_t i = 0; i < 5; ++i) {
+        LogEntry entry{i, "message " + to_string(i), true, false};
+        EXPECT_TRUE(buffer.tryPush(entry));
+    }
+
+    LogEntry result;
+    for (u_int64_t i = 0; i < 5; ++i) {
+        ASSERT_TRUE(buffer.tryPop(result));
+        EXPECT_EQ(i, result.time_);
+        EXPECT_EQ("message " + to_string(i), result.message_);
+    }
+    EXPECT_FALSE(buffer.tryPop(result));
+    EXPECT_EQ(5u, buffer.getPushedNumber());
+    EXPECT_EQ(5u, buffer.getPoppedNumber());
+}
+
+
+TEST(PushAndPop, pushFailsWhenFull) {
+    LogRingBuffer buffer = LogRingBuffer(4);
+    for (u_int64_t i = 0; i < 4; ++i) {
+        LogEntry entry{i, "message", true, false};
+        EXPECT_TRUE(buffer.tryPush(entry));
+    }
+
+    LogEntry entry{4, "not saved", true, true};
+    EXPECT_FALSE(buffer.tryPush(entry));
+    EXPECT_EQ("not saved", entry.message_);
+
+    LogEntry result;
+    EXPECT_TRUE(buffer.tryPop(result));
+    EXPECT_TRUE(buffer.tryPush(entry));
+}
+
+
+TEST(PushAndPop, manyProducersOneConsumer) {
+    const unsigned int producers_number = 4;
+    const u_int64_t entries_per_producer = 20000;
+    LogRingBuffer buffer = LogRingBuffer(64);
+
+    vector<thread> producers;
+    for (unsigned int producer = 0; producer < producers_number; ++producer) {
+        producers.emplace_back([&buffer, producer, entries_per_producer]() {
+            for (u_int64_t i = 0; i < entries_per_producer; ++i) {
+                LogEntry entry{i, to_string(producer), true, false};
+                while (!buffer.tryPush(entry)) {
+                    this_thread::yield();
+                }
+            }
+        });
+    }
+
+    vector<u_int64_t> next_expected(producers_number, 0);
+    u_int64_t popped = 0;
+    LogEntry result;
+    while (popped < producers_number * entries_per_producer) {
+        if (buffer.tryPop(result)) {
+            unsigned int producer = static_cast<unsigned int>(stoul(result.message_));
+            EXPECT_EQ(next_expected[producer], result.time_);
+            next_expected[producer] = result.time_ + 1;
+            ++popped;
+        }
+        else {
+            this_thread::yield();
+        }
+    }
+    for (thread& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_FALSE(buffer.tryPop(result));
+}
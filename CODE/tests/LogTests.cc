@@ -18,6 +18,15 @@ TEST(ConstructorAndGetters, constructorAndGetters) {
 }
 
 
+TEST(ConstructorAndGetters, logsAreErrorsByDefault) {
+    Log error = Log(20, "Attempted to move outside the lawn.");
+    Log info = Log(20, "Arrived at point with id:  0", false);
+
+    EXPECT_TRUE(error.isError());
+    EXPECT_FALSE(info.isError());
+}
+
+
 TEST(OperatorEquals, equals) {
     u_int64_t time = 20;
     string message = "Hello";
@@ -51,6 +60,15 @@ TEST(OperatorEquals, notEqualsMessage) {
 }
 
 
+TEST(OperatorEquals, notEqualsSeverity) {
+    Log log = Log(20, "Hello");
+    Log log2 = Log(20, "Hello", false);
+
+    bool result = log == log2;
+    EXPECT_FALSE(result);
+}
+
+
 TEST(OperatorNotEquals, notEquals) {
     u_int64_t time = 20;
     string message = "Hello";
@@ -71,3 +89,23 @@ TEST(OperatorNotEquals, equals) {
     bool result = log != log2;
     EXPECT_FALSE(result);
 }
+
+
+TEST(Move, moveKeepsMessage) {
+    Log log = Log(10, "Hello");
+
+    Log result_log = std::move(log);
+
+    EXPECT_EQ(10u, result_log.getTime());
+    EXPECT_EQ("Hello", result_log.getMessage());
+}
+
+
+TEST(ReleaseMessage, releaseMessage) {
+    Log log = Log(10, "Hello");
+
+    string result_message = log.releaseMessage();
+
+    EXPECT_EQ("Hello", result_message);
+    EXPECT_EQ("", log.getMessage());
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <string>
+#include <vector>
 #include "../include/Logger.h"
 
 using namespace std;
@@ -8,9 +9,9 @@ using namespace std;
 TEST(ConstructorAndGetter, constructorAndGetter) {
     Logger logger = Logger();
 
-    const queue<Log>& result_queue = logger.getLogs();
+    const vector<Log>& result_queue = logger.getLogs();
 
-    EXPECT_EQ(queue<Log>(), result_queue);
+    EXPECT_TRUE(result_queue.empty());
 }
 
 
@@ -19,7 +20,7 @@ TEST(push, logs) {
     Log log = Log(10, "Hello");
 
     logger.push(std::move(log));
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
     int result_size = 1;
 
     EXPECT_EQ(result_size, result_logs.size());
@@ -30,7 +31,7 @@ TEST(push, emptyLogs) {
     Logger logger = Logger();
     int result_size = 0;
 
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
 
     EXPECT_EQ(result_size, result_logs.size());
 }
@@ -42,7 +43,7 @@ TEST(clear, clear) {
 
     logger.push(std::move(log));
     logger.clear();
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
     int result_size = 0;
 
     EXPECT_EQ(result_size, result_logs.size());
@@ -53,8 +54,72 @@ TEST(clear, clearEmptyQueue) {
     Logger logger = Logger();
 
     logger.clear();
-    const queue<Log>& result_logs = logger.getLogs();
+    const vector<Log>& result_logs = logger.getLogs();
     int result_size = 0;
 
     EXPECT_EQ(result_size, result_logs.size());
 }
+
+
+TEST(drain, drainsLogsInOrder) {
+    Logger logger = Logger();
+    logger.push(Log(10, "first"));
+    logger.push(Log(20, "second"));
+    vector<Log> result_logs;
+
+    size_t result_number = logger.drain([&result_logs](Log&& log) {
+        result_logs.push_back(std::move(log));
+    });
+
+    EXPECT_EQ(2u, result_number);
+    ASSERT_EQ(2u, result_logs.size());
+    EXPECT_EQ(Log(10, "first"), result_logs[0]);
+    EXPECT_EQ(Log(20, "second"), result_logs[1]);
+    EXPECT_TRUE(logger.getLogs().empty());
+}
+
+
+TEST(drain, emptyLogger) {
+    Logger logger = Logger();
+    int result_calls = 0;
+
+    size_t result_number = logger.drain([&result_calls](Log&&) { ++result_calls; });
+
+    EXPECT_EQ(0u, result_number);
+    EXPECT_EQ(0, result_calls);
+}
+
+
+TEST(drain, logsPushedByConsumerKeptForNextDrain) {
+    Logger logger = Logger();
+    logger.push(Log(10, "first"));
+
+    logger.drain([&logger](Log&& log) {
+        logger.push(Log(log.getTime() + 1, "pushed while draining"));
+    });
+
+    ASSERT_EQ(1u, logger.getLogs().size());
+    EXPECT_EQ(Log(11, "pushed while draining"), logger.getLogs().front());
+}
+
+
+TEST(drain, buffersKeepCapacity) {
+    Logger logger = Logger();
+    logger.push(Log(1, "a"));
+    logger.drain([](Log&&) {});
+    logger.push(Log(2, "b"));
+    logger.drain([](Log&&) {});
+    const Log* first_buffer = nullptr;
+    const Log* second_buffer = nullptr;
+
+    logger.push(Log(3, "c"));
+    first_buffer = logger.getLogs().data();
+    logger.drain([](Log&&) {});
+    logger.push(Log(4, "d"));
+    second_buffer = logger.getLogs().data();
+    logger.drain([](Log&&) {});
+    logger.push(Log(5, "e"));
+
+    EXPECT_NE(first_buffer, second_buffer);
+    EXPECT_EQ(first_buffer, logger.getLogs().data());
+}
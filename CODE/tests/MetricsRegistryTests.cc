@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "../include/MetricsRegistry.h"
+
+using namespace std;
+
+
+TEST(MetricsRegistry, addReturnsSameMetricForName) {
+    MetricsRegistry metrics;
+
+    MetricCounter& counter = metrics.addCounter("ticks");
+    counter.add();
+    counter.add(4);
+    LatencyHistogram& histogram = metrics.addHistogram("tick_duration_ns");
+    histogram.record(100);
+
+    EXPECT_EQ(&counter, &metrics.addCounter("ticks"));
+    EXPECT_EQ(&histogram, &metrics.addHistogram("tick_duration_ns"));
+    EXPECT_EQ(5u, metrics.findCounter("ticks")->get());
+    EXPECT_EQ(1u, metrics.findHistogram("tick_duration_ns")->getCount());
+    EXPECT_EQ(nullptr, metrics.findCounter("tick_duration_ns"));
+    EXPECT_EQ(nullptr, metrics.findHistogram("unknown"));
+}
+
+
+TEST(MetricsRegistry, resetClearsAllMetrics) {
+    MetricsRegistry metrics;
+    metrics.addCounter("bytes").set(1024);
+    metrics.addHistogram("latency_ns").record(10);
+
+    metrics.reset();
+
+    EXPECT_EQ(0u, metrics.findCounter("bytes")->get());
+    EXPECT_EQ(0u, metrics.findHistogram("latency_ns")->getCount());
+}
+
+
+TEST(MetricsRegistry, writeMetricsSortedByName) {
+    MetricsRegistry metrics;
+    metrics.addCounter("ticks").add(3);
+    metrics.addCounter("bytes").set(7);
+    LatencyHistogram& histogram = metrics.addHistogram("steps");
+    histogram.record(2);
+    histogram.record(2);
+
+    ostringstream output;
+    metrics.writeMetrics(output);
+
+    EXPECT_EQ("bytes 7\nticks 3\nsteps count=2 mean=2 p50=3 p99=3 max=2\n", output.str());
+}
+
+
+TEST(MetricsRegistry, saveMetricsReplacesFile) {
+    string path = "metrics_registry_save.txt";
+    MetricsRegistry metrics;
+    MetricCounter& counter = metrics.addCounter("ticks");
+
+    counter.set(1);
+    ASSERT_TRUE(metrics.saveMetrics(path));
+    counter.set(2);
+    ASSERT_TRUE(metrics.saveMetrics(path));
+
+    ifstream file(path);
+    stringstream content;
+    content << file.rdbuf();
+    EXPECT_EQ("ticks 2\n", content.str());
+    EXPECT_FALSE(ifstream(path + ".tmp").good());
+    remove(path.c_str());
+
+    EXPECT_FALSE(metrics.saveMetrics("not_existing_directory/metrics.txt"));
+}
@@ -10,8 +10,6 @@ TEST(MowerControllerUpdate, updateExecutesNoCommandsWhenQueueIsEmpty) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
@@ -32,10 +30,8 @@ TEST(MowerControllerMove, moveAddsCommandToQueue) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -56,10 +52,8 @@ TEST(MowerControllerMove, moveWithPointerAddsCommandToQueue) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -81,10 +75,8 @@ TEST(MowerControllerRotate, rotateAddsCommandToQueue) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -106,10 +98,8 @@ TEST(MowerControllerSetMowing, setMowingEnableTurnsOnMowing) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     mower.turnOffMowing();
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
@@ -131,10 +121,8 @@ TEST(MowerControllerSetMowing, setMowingDisableTurnsOffMowing) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -155,10 +143,8 @@ TEST(MowerControllerAddPoint, addPointAddsPointToSimulation) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -181,10 +167,8 @@ TEST(MowerControllerDeletePoint, deletePointRemovesPointFromSimulation) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -210,10 +194,8 @@ TEST(MowerControllerMoveToPoint, moveToPointMovesNearPointLocation) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 100.0, 100.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 100.0, 100.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -248,8 +230,6 @@ TEST(MowerControllerGetDistanceToPoint, getDistanceToPointCalculatesCorrectDista
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
@@ -277,8 +257,6 @@ TEST(MowerControllerRotateTowardsPoint, rotateTowardsPointChangesAngle) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
     Logger logger = Logger();
@@ -306,10 +284,8 @@ TEST(MowerControllerUpdate, updateExecutesMultipleCommandsInOrder) {
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 500.0, 500.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 500.0, 500.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -334,10 +310,8 @@ TEST(MowerControllerGetCurrentPosition, getCurrentPositionRetrievesMowerPosition
     unsigned int mower_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(mower_width, mower_length, 450.0, 550.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed);
+    Mower mower = Mower(mower_width, mower_length, blade_diameter, speed, 450.0, 550.0, 0);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("test_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -351,3 +325,43 @@ TEST(MowerControllerGetCurrentPosition, getCurrentPositionRetrievesMowerPosition
     EXPECT_DOUBLE_EQ(450.0, out_x);
     EXPECT_DOUBLE_EQ(550.0, out_y);
 }
+
+TEST(MowerControllerUpdateUntil, updateUntilExecutesCommandsUpToEndTime) {
+    Lawn stepped_lawn = Lawn(1000, 1000);
+    Mower stepped_mower = Mower(120, 100, 90, 100, 500.0, 500.0, 0);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("test_path");
+    StateSimulation stepped_simulation = StateSimulation(stepped_lawn, stepped_mower, logger, fileLogger);
+    MowerController stepped_controller = MowerController();
+    stepped_controller.rotate(90);
+    stepped_controller.setMowing(true);
+    stepped_controller.move(200.0);
+    while (stepped_controller.hasPendingCommands()) {
+        stepped_controller.update(stepped_simulation, 0.02);
+    }
+
+    Lawn lawn = Lawn(1000, 1000);
+    Mower mower = Mower(120, 100, 90, 100, 500.0, 500.0, 0);
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    MowerController controller = MowerController();
+    controller.rotate(90);
+    controller.setMowing(true);
+    controller.move(200.0);
+
+    EXPECT_EQ(500u, controller.updateUntil(stateSimulation, 0.02, 500));
+    EXPECT_TRUE(controller.hasPendingCommands());
+
+    // stops at the end of the rotation, the next call moves to the end of the move
+    u_int64_t rotation_end_time = controller.updateUntil(stateSimulation, 0.02, 100000);
+    EXPECT_EQ(stepped_mower.getAngle(), mower.getAngle());
+    EXPECT_EQ(500.0, mower.getX());
+    EXPECT_LT(rotation_end_time, stepped_simulation.getTime());
+    EXPECT_TRUE(controller.hasPendingCommands());
+    EXPECT_EQ(stepped_simulation.getTime(), controller.updateUntil(stateSimulation, 0.02, 100000));
+    EXPECT_FALSE(controller.hasPendingCommands());
+    EXPECT_EQ(stepped_simulation.getTime(), stateSimulation.getTime());
+    // positions are rounded after every move, so separate steps differ slightly
+    EXPECT_NEAR(stepped_mower.getX(), mower.getX(), 0.05);
+    EXPECT_NEAR(stepped_mower.getY(), mower.getY(), 0.05);
+    EXPECT_EQ(stepped_mower.getAngle(), mower.getAngle());
+}
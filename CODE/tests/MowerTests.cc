@@ -5,7 +5,9 @@
 */
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include "../include/Config.h"
+#include "../include/MathHelper.h"
 #include "../include/Mower.h"
 #include "../include/Exceptions.h"
 
@@ -17,7 +19,6 @@ TEST(ConstructorAndGetters, constructorAndGetters) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
 
     unsigned int result_width = mower.getWidth();
@@ -45,7 +46,6 @@ TEST(OperatorEquals, equals) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width, length, blade_diameter, speed);
 
@@ -59,7 +59,6 @@ TEST(OperatorEquals, notEqualsWidth) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width + 1, length, blade_diameter, speed);
 
@@ -73,7 +72,6 @@ TEST(OperatorEquals, notEqualsLength) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width, length + 1, blade_diameter, speed);
 
@@ -87,7 +85,6 @@ TEST(OperatorEquals, notEqualsBladeDiameter) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width, length, blade_diameter + 1, speed);
 
@@ -101,7 +98,6 @@ TEST(OperatorEquals, notEqualsSpeed) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width, length, blade_diameter, speed + 1);
 
@@ -115,7 +111,6 @@ TEST(OperatorEquals, notEqualsX) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     mower.setX(mower.getX() + 1);
     Mower mower2 = Mower(width, length, blade_diameter, speed);
@@ -130,7 +125,6 @@ TEST(OperatorEquals, notEqualsY) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     mower.setY(mower.getY() + 1);
     Mower mower2 = Mower(width, length, blade_diameter, speed);
@@ -145,7 +139,6 @@ TEST(OperatorEquals, notEqualsAngle) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     mower.setAngle(mower.getAngle() + 1);
     Mower mower2 = Mower(width, length, blade_diameter, speed);
@@ -160,7 +153,6 @@ TEST(OperatorEquals, notEqualsIsMowing) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width, length, blade_diameter, speed);
     mower.turnOffMowing();
@@ -175,7 +167,6 @@ TEST(OperatorNotEquals, notEquals) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width + 1, length, blade_diameter, speed);
 
@@ -189,7 +180,6 @@ TEST(OperatorNotEquals, equals) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width, length, blade_diameter, speed);
 
@@ -206,7 +196,6 @@ TEST(Setters, setters) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     mower.setAngle(angle);
     mower.setX(x);
@@ -233,9 +222,7 @@ TEST(Move, moveInsideLawnDefaultSpawnPoint) {
     unsigned int lawn_length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0.0, 0.0, angle);
     mower.move(distance, lawn_width, lawn_length);
 
     unsigned int result_angle = mower.getAngle();
@@ -259,9 +246,7 @@ TEST(Move, moveInsideLawnDoubleDistanceSpawnPoint) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0.0, 0.0, angle);
     mower.move(distance, lawn_width, lawn_length);
 
     unsigned int result_angle = mower.getAngle();
@@ -285,9 +270,7 @@ TEST(Move, moveInsideLawnHardAngleDefaultSpawnPoint) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0.0, 0.0, angle);
     mower.move(distance, lawn_width, lawn_length);
 
     unsigned int result_angle = mower.getAngle();
@@ -311,9 +294,7 @@ TEST(Move, moveInsideLawnHardAngleDoubleDistanceDefaultSpawnPoint) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0.0, 0.0, angle);
     mower.move(distance, lawn_width, lawn_length);
 
     unsigned int result_angle = mower.getAngle();
@@ -337,9 +318,7 @@ TEST(Move, moveInsideLawnHardAngleDoubleDistanceCustomSpawnPoint) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 30.298, 40.207, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 30.298, 40.207, angle);
     mower.move(distance, lawn_width, lawn_length);
 
     unsigned int result_angle = mower.getAngle();
@@ -363,9 +342,7 @@ TEST(Move, moveInsideLawnBorderXDefaultSpawnPoint) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
     mower.move(distance, lawn_width, lawn_length);
 
     unsigned int result_angle = mower.getAngle();
@@ -389,9 +366,7 @@ TEST(Move, moveInsideLawnBorderYDefaultSpawnPoint) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
     mower.move(distance, lawn_width, lawn_length);
 
     unsigned int result_angle = mower.getAngle();
@@ -413,9 +388,7 @@ TEST(Move, moveOutsideLawnBorderYDefaultSpawnPointMinimalDeltaX) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
 
     EXPECT_THROW({mower.move(distance, lawn_width, lawn_length);}, MoveOutsideLawnError);
 }
@@ -430,9 +403,7 @@ TEST(Move, moveOutsideLawnBorderYDefaultSpawnPointMinimalDeltaY) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
 
     EXPECT_THROW({mower.move(distance, lawn_width, lawn_length);}, MoveOutsideLawnError);
 }
@@ -447,9 +418,7 @@ TEST(Move, moveOutsideLawnBorderDefaultSpawnPoint) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
 
     EXPECT_THROW({mower.move(distance, lawn_width, lawn_length);}, MoveOutsideLawnError);
 }
@@ -464,9 +433,7 @@ TEST(Move, moveOutsideLawnBorderDefaultSpawnPointNegativeX) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
 
     EXPECT_THROW({mower.move(distance, lawn_width, lawn_length);}, MoveOutsideLawnError);
 }
@@ -481,9 +448,7 @@ TEST(Move, moveOutsideLawnBorderDefaultSpawnPointNegativeY) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
 
     EXPECT_THROW({mower.move(distance, lawn_width, lawn_length);}, MoveOutsideLawnError);
 }
@@ -498,9 +463,7 @@ TEST(Move, moveOutsideLawnBorderDefaultSpawnPointNegativeXY) {
     unsigned int speed = 105;
     unsigned int lawn_width = 120;
     unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, angle);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, angle);
 
     EXPECT_THROW({mower.move(distance, lawn_width, lawn_length);}, MoveOutsideLawnError);
 }
@@ -513,10 +476,6 @@ TEST(Rotate, rotatePositiveAngleDefaultSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
 
     mower.rotate(angle_to_rotate);
@@ -533,10 +492,6 @@ TEST(Rotate, rotateMaxPositiveAngleDefaultSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
 
     mower.rotate(angle_to_rotate);
@@ -553,10 +508,6 @@ TEST(Rotate, rotateNegativeAngleDefaultSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
 
     mower.rotate(angle_to_rotate);
@@ -573,10 +524,6 @@ TEST(Rotate, rotateMinNegativeAngleDefaultSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
 
     mower.rotate(angle_to_rotate);
@@ -593,11 +540,7 @@ TEST(Rotate, rotatePositiveAngleCustomSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 75);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 75);
 
     mower.rotate(angle_to_rotate);
     unsigned short result_angle = mower.getAngle();
@@ -613,11 +556,7 @@ TEST(Rotate, rotateNegativeAngleCustomSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 75);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 75);
 
     mower.rotate(angle_to_rotate);
     unsigned short result_angle = mower.getAngle();
@@ -633,11 +572,7 @@ TEST(Rotate, rotateMaxPositiveAngleCustomSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 30);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 30);
 
     mower.rotate(angle_to_rotate);
     unsigned short result_angle = mower.getAngle();
@@ -653,11 +588,7 @@ TEST(Rotate, rotateMinNegativeAngleCustomSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 30);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 30);
 
     mower.rotate(angle_to_rotate);
     unsigned short result_angle = mower.getAngle();
@@ -673,11 +604,7 @@ TEST(Rotate, rotateCustomNegativeAngleCustomSpawnAngle) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 30);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 30);
 
     mower.rotate(angle_to_rotate);
     unsigned short result_angle = mower.getAngle();
@@ -688,16 +615,11 @@ TEST(Rotate, rotateCustomNegativeAngleCustomSpawnAngle) {
 
 TEST(Rotate, rotateTooBigPositiveAngle) {
     short angle_to_rotate = 361;
-    unsigned short angle = 165;
     unsigned int width = 10;
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 30);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 30);
 
     EXPECT_THROW({mower.rotate(angle_to_rotate);}, RotationAngleOutOfRangeError);
 }
@@ -705,16 +627,11 @@ TEST(Rotate, rotateTooBigPositiveAngle) {
 
 TEST(Rotate, rotateTooSmallNegativeAngle) {
     short angle_to_rotate = -361;
-    unsigned short angle = 165;
     unsigned int width = 10;
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 30);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 30);
 
     EXPECT_THROW({mower.rotate(angle_to_rotate);}, RotationAngleOutOfRangeError);
 }
@@ -725,10 +642,6 @@ TEST(TurnOnMowing, turnOn) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     mower.turnOffMowing();
     mower.turnOnMowing();
@@ -742,12 +655,57 @@ TEST(TurnOffMowing, turnOff) {
     unsigned int length = 10;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    unsigned int lawn_width = 120;
-    unsigned int lawn_length = 100;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 0);
     Mower mower = Mower(width, length, blade_diameter, speed);
     mower.turnOffMowing();
 
     EXPECT_FALSE(mower.getIsMowing());
 }
+
+
+TEST(Heading, headingFollowsAngle) {
+    Mower mower = Mower(10, 10, 90, 105, 0.0, 0.0, 90);
+
+    EXPECT_DOUBLE_EQ(1.0, mower.getHeadingX());
+    EXPECT_DOUBLE_EQ(0.0, mower.getHeadingY());
+
+    mower.rotate(-60);
+    EXPECT_DOUBLE_EQ(0.5, mower.getHeadingX());
+    EXPECT_NEAR(sqrt(3.0) / 2.0, mower.getHeadingY(), 1e-15);
+
+    mower.setAngle(270);
+    EXPECT_DOUBLE_EQ(-1.0, mower.getHeadingX());
+    EXPECT_DOUBLE_EQ(0.0, mower.getHeadingY());
+}
+
+
+TEST(Heading, moveAlongAxisKeepsOtherCoordinate) {
+    Mower mower = Mower(10, 10, 90, 105, 50.0, 50.0, 180);
+
+    mower.move(30.0, 100, 100);
+
+    EXPECT_EQ(50.0, mower.getX());
+    EXPECT_EQ(20.0, mower.getY());
+}
+
+
+TEST(TrigonometryTables, tablesMatchTrigonometricFunctions) {
+    for (unsigned short angle = 0; angle < 360; ++angle) {
+        double angle_in_radians = angle * M_PI / 180.0;
+
+        EXPECT_NEAR(sin(angle_in_radians), MathHelper::getSin(angle), 1e-15) << angle;
+        EXPECT_NEAR(cos(angle_in_radians), MathHelper::getCos(angle), 1e-15) << angle;
+        if (angle % 180 != 0) {
+            EXPECT_NEAR(1.0 / tan(angle_in_radians), MathHelper::getCot(angle), 
+                1e-13 * max(1.0, fabs(MathHelper::getCot(angle)))) << angle;
+        }
+    }
+    EXPECT_EQ(MathHelper::getSin(30), MathHelper::getSin(390));
+}
+
+
+TEST(TrigonometryTables, cotangentOfStraightAnglesIsInfinite) {
+    EXPECT_TRUE(isinf(MathHelper::getCot(0)));
+    EXPECT_GT(MathHelper::getCot(0), 0.0);
+    EXPECT_TRUE(isinf(MathHelper::getCot(180)));
+    EXPECT_LT(MathHelper::getCot(180), 0.0);
+}
@@ -0,0 +1,250 @@
+/*
+    Author: Hanna Biegacz
+
+    Tests Scenario and ScenarioParser classes.
+*/
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../include/Scenario.h"
+#include "../include/Exceptions.h"
+
+using namespace std;
+
+
+TEST(ScenarioParse, parseHeader) {
+    istringstream input(
+        "# comment\n"
+        "lawn 800 600\n"
+        "mower 50 40 30 100   # trailing comment\n"
+        "start 10 20 90\n"
+        "max_time 120\n"
+        "log out.log\n");
+
+    Scenario scenario = ScenarioParser::parse(input, "test");
+
+    EXPECT_EQ("test", scenario.name_);
+    EXPECT_EQ(800u, scenario.lawn_width_);
+    EXPECT_EQ(600u, scenario.lawn_length_);
+    EXPECT_EQ(50u, scenario.mower_width_);
+    EXPECT_EQ(40u, scenario.mower_length_);
+    EXPECT_EQ(30u, scenario.blade_diameter_);
+    EXPECT_EQ(100u, scenario.mower_speed_);
+    EXPECT_DOUBLE_EQ(10.0, scenario.starting_x_);
+    EXPECT_DOUBLE_EQ(20.0, scenario.starting_y_);
+    EXPECT_EQ(90, scenario.starting_angle_);
+    EXPECT_DOUBLE_EQ(120.0, scenario.max_simulation_time_);
+    EXPECT_EQ("out.log", scenario.log_path_);
+    EXPECT_EQ(LogFileFormat::TEXT, scenario.log_format_);
+    EXPECT_TRUE(scenario.commands_.empty());
+}
+
+
+TEST(ScenarioParse, binaryLogFormat) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 40 30 100\n"
+        "log out.bin binary\n");
+
+    Scenario scenario = ScenarioParser::parse(input, "test");
+
+    EXPECT_EQ("out.bin", scenario.log_path_);
+    EXPECT_EQ(LogFileFormat::BINARY, scenario.log_format_);
+
+    istringstream invalid_input(
+        "lawn 800 600\n"
+        "mower 50 40 30 100\n"
+        "log out.bin json\n");
+
+    EXPECT_THROW(ScenarioParser::parse(invalid_input, "test"), ScenarioParseError);
+}
+
+
+TEST(ScenarioParse, logLevels) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 40 30 100\n"
+        "log_level all off\n"
+        "log_level errors info\n");
+
+    Scenario scenario = ScenarioParser::parse(input, "test");
+
+    EXPECT_EQ(LogFilter::createErrorsOnly(), scenario.log_filter_);
+
+    istringstream invalid_input(
+        "lawn 800 600\n"
+        "mower 50 40 30 100\n"
+        "log_level wheels off\n");
+
+    EXPECT_THROW(ScenarioParser::parse(invalid_input, "test"), ScenarioParseError);
+}
+
+
+TEST(ScenarioParse, parseCommands) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 50 50 100\n"
+        "commands\n"
+        "add_point 400 300\n"
+        "mowing off\n"
+        "move_to_point 0\n"
+        "mowing on\n"
+        "move 12.5\n"
+        "rotate -90\n");
+
+    Scenario scenario = ScenarioParser::parse(input, "test");
+
+    ASSERT_EQ(6u, scenario.commands_.size());
+    EXPECT_EQ("add_point", scenario.commands_[0].name_);
+    EXPECT_EQ(vector<double>({400.0, 300.0}), scenario.commands_[0].arguments_);
+    EXPECT_EQ(vector<double>({0.0}), scenario.commands_[1].arguments_);
+    EXPECT_EQ(vector<double>({1.0}), scenario.commands_[3].arguments_);
+    EXPECT_EQ("move", scenario.commands_[4].name_);
+    EXPECT_EQ(vector<double>({12.5}), scenario.commands_[4].arguments_);
+    EXPECT_EQ(vector<double>({-90.0}), scenario.commands_[5].arguments_);
+}
+
+
+TEST(ScenarioParse, repeatBlocksExpanded) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 50 50 100\n"
+        "commands\n"
+        "repeat 3\n"
+        "    move 1\n"
+        "    repeat 2\n"
+        "        rotate 1\n"
+        "    end\n"
+        "end\n"
+        "move 5\n");
+
+    Scenario scenario = ScenarioParser::parse(input, "test");
+
+    ASSERT_EQ(10u, scenario.commands_.size());
+    EXPECT_EQ("move", scenario.commands_[0].name_);
+    EXPECT_EQ("rotate", scenario.commands_[1].name_);
+    EXPECT_EQ("rotate", scenario.commands_[2].name_);
+    EXPECT_EQ("move", scenario.commands_[3].name_);
+    EXPECT_EQ(vector<double>({5.0}), scenario.commands_[9].arguments_);
+}
+
+
+TEST(ScenarioParse, missingLawnThrows) {
+    istringstream input("mower 50 50 50 100\n");
+
+    EXPECT_THROW(ScenarioParser::parse(input, "test"), ScenarioParseError);
+}
+
+
+TEST(ScenarioParse, unknownCommandThrows) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 50 50 100\n"
+        "commands\n"
+        "jump 10\n");
+
+    EXPECT_THROW(ScenarioParser::parse(input, "test"), ScenarioParseError);
+}
+
+
+TEST(ScenarioParse, missingArgumentThrows) {
+    istringstream input(
+        "lawn 800\n"
+        "mower 50 50 50 100\n");
+
+    EXPECT_THROW(ScenarioParser::parse(input, "test"), ScenarioParseError);
+}
+
+
+TEST(ScenarioParse, unclosedRepeatThrows) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 50 50 100\n"
+        "commands\n"
+        "repeat 2\n"
+        "move 1\n");
+
+    EXPECT_THROW(ScenarioParser::parse(input, "test"), ScenarioParseError);
+}
+
+
+TEST(ScenarioParse, errorMessageContainsLine) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 50 50 100\n"
+        "commands\n"
+        "mowing maybe\n");
+
+    try {
+        ScenarioParser::parse(input, "test");
+        FAIL();
+    } catch (const ScenarioParseError& e) {
+        EXPECT_NE(string::npos, string(e.what()).find("test:4"));
+    }
+}
+
+
+TEST(ScenarioParse, negativeLawnSizeThrows) {
+    istringstream input(
+        "lawn -800 600\n"
+        "mower 50 50 50 100\n");
+
+    try {
+        ScenarioParser::parse(input, "test");
+        FAIL();
+    } catch (const ScenarioParseError& e) {
+        EXPECT_NE(string::npos, string(e.what()).find("test:1"));
+    }
+}
+
+
+TEST(ScenarioParse, startingAngleOutOfRangeThrows) {
+    for (const string& angle : vector<string>{"-90", "360", "45.5"}) {
+        istringstream input(
+            "lawn 800 600\n"
+            "mower 50 50 50 100\n"
+            "start 10 10 " + angle + "\n");
+
+        EXPECT_THROW(ScenarioParser::parse(input, "test"), ScenarioParseError) << angle;
+    }
+}
+
+
+TEST(ScenarioParse, incorrectCommandArgumentsThrow) {
+    for (const string& command : vector<string>{"move_to_point -1", "delete_point 1.5", "rotate_towards_point 1e12", 
+            "rotate 361", "rotate -400", "repeat -1"}) {
+        istringstream input(
+            "lawn 800 600\n"
+            "mower 50 50 50 100\n"
+            "commands\n" + 
+            command + "\n");
+
+        EXPECT_THROW(ScenarioParser::parse(input, "test"), ScenarioParseError) << command;
+    }
+}
+
+
+TEST(ScenarioParse, boundaryArgumentsAccepted) {
+    istringstream input(
+        "lawn 800 600\n"
+        "mower 50 50 50 100\n"
+        "start -5.5 10 359\n"
+        "commands\n"
+        "rotate -360\n"
+        "move -2.5\n"
+        "move_to_point 0\n");
+
+    Scenario scenario = ScenarioParser::parse(input, "test");
+
+    EXPECT_EQ(359, scenario.starting_angle_);
+    EXPECT_DOUBLE_EQ(-5.5, scenario.starting_x_);
+    ASSERT_EQ(3u, scenario.commands_.size());
+    EXPECT_DOUBLE_EQ(-360.0, scenario.commands_[0].arguments_[0]);
+}
+
+
+TEST(ScenarioParseFile, missingFileThrows) {
+    EXPECT_THROW(ScenarioParser::parseFile("not_existing.scenario"), ScenarioParseError);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include "../include/SnapshotChannel.h"
+
+using namespace std;
+
+namespace {
+    SimulationSnapshot createSnapshot(double time) {
+        SimulationSnapshot snapshot;
+        snapshot.simulation_time_ = time;
+        snapshot.x_ = time * 2.0;
+        return snapshot;
+    }
+}
+
+TEST(SnapshotChannelTest, capacityRoundedToPowerOfTwo) {
+    SnapshotChannel channel(50);
+
+    EXPECT_EQ(64u, channel.getCapacity());
+}
+
+TEST(SnapshotChannelTest, popReturnsSnapshotsInOrder) {
+    SnapshotChannel channel(4);
+    SimulationSnapshot snapshot;
+
+    EXPECT_FALSE(channel.tryPop(snapshot));
+
+    channel.push(createSnapshot(1.0));
+    channel.push(createSnapshot(2.0));
+
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(1.0, snapshot.simulation_time_);
+    EXPECT_DOUBLE_EQ(2.0, snapshot.x_);
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(2.0, snapshot.simulation_time_);
+    EXPECT_FALSE(channel.tryPop(snapshot));
+}
+
+TEST(SnapshotChannelTest, fullChannelKeepsNewestSnapshot) {
+    SnapshotChannel channel(2);
+    SimulationSnapshot snapshot;
+
+    for (int i = 1; i <= 5; ++i) {
+        channel.push(createSnapshot(i));
+    }
+    EXPECT_EQ(2u, channel.getReplacedNumber());
+
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(1.0, snapshot.simulation_time_);
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(2.0, snapshot.simulation_time_);
+    EXPECT_FALSE(channel.tryPop(snapshot));
+
+    channel.push(createSnapshot(6));
+
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(5.0, snapshot.simulation_time_);
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(6.0, snapshot.simulation_time_);
+}
+
+TEST(SnapshotChannelTest, concurrentProducerAndConsumer) {
+    SnapshotChannel channel(8);
+    const int snapshots_number = 100000;
+    atomic<bool> is_producer_finished{false};
+
+    thread producer([&channel, &is_producer_finished, snapshots_number]() {
+        for (int i = 1; i <= snapshots_number; ++i) {
+            channel.push(createSnapshot(i));
+        }
+        while (!channel.flush()) {
+            this_thread::yield();
+        }
+        is_producer_finished.store(true);
+    });
+
+    SimulationSnapshot snapshot;
+    double last_time = 0.0;
+    size_t popped_number = 0;
+    bool is_ordered = true;
+    while (true) {
+        bool is_finished = is_producer_finished.load();
+        if (channel.tryPop(snapshot)) {
+            is_ordered = is_ordered && snapshot.simulation_time_ > last_time && snapshot.x_ == snapshot.simulation_time_ * 2.0;
+            last_time = snapshot.simulation_time_;
+            ++popped_number;
+        }
+        else if (is_finished) {
+            break;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(is_ordered);
+    EXPECT_EQ(static_cast<double>(snapshots_number), last_time);
+    EXPECT_EQ(static_cast<size_t>(snapshots_number), popped_number + channel.getReplacedNumber());
+}
+
+TEST(SnapshotChannelTest, flushPublishesKeptSnapshot) {
+    SnapshotChannel channel(2);
+    SimulationSnapshot snapshot;
+
+    for (int i = 1; i <= 3; ++i) {
+        channel.push(createSnapshot(i));
+    }
+    EXPECT_FALSE(channel.flush());
+
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_TRUE(channel.flush());
+    EXPECT_TRUE(channel.flush());
+
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(2.0, snapshot.simulation_time_);
+    ASSERT_TRUE(channel.tryPop(snapshot));
+    EXPECT_DOUBLE_EQ(3.0, snapshot.simulation_time_);
+    EXPECT_FALSE(channel.tryPop(snapshot));
+}
@@ -178,3 +178,78 @@ TEST(StateInterpolatorTest, getSimulationTimeReturnsZeroIfEmpty) {
 
     EXPECT_DOUBLE_EQ(sim_time, 0.0);
 }
+
+TEST(StateInterpolatorTest, sameTimestampSnapshotReplacesLatest) {
+    StateInterpolator interpolator;
+
+    SimulationSnapshot snapshot1;
+    snapshot1.simulation_time_ = 1000.0;
+    snapshot1.x_ = 1.0;
+    interpolator.addSimulationSnapshot(snapshot1);
+
+    SimulationSnapshot snapshot2 = snapshot1;
+    snapshot2.x_ = 5.0;
+    interpolator.addSimulationSnapshot(snapshot2);
+
+    SimulationSnapshot result = interpolator.getInterpolatedState(1000.0);
+
+    EXPECT_DOUBLE_EQ(result.x_, 5.0);
+}
+
+TEST(StateInterpolatorTest, latenciesAreRecorded) {
+    StateInterpolator interpolator;
+
+    SimulationSnapshot snapshot;
+    snapshot.simulation_time_ = 1000.0;
+    interpolator.addSimulationSnapshot(snapshot);
+    interpolator.getInterpolatedState(1000.0);
+    interpolator.getInterpolatedState(1000.0);
+
+    EXPECT_EQ(interpolator.getPublishLatency().getCount(), 1u);
+    EXPECT_EQ(interpolator.getReadLatency().getCount(), 2u);
+}
+
+TEST(StateInterpolatorTest, getInterpolatedPoseBlendsPoseOnly) {
+    StateInterpolator interpolator;
+
+    SimulationSnapshot snapshot1;
+    snapshot1.simulation_time_ = 1000.0;
+    snapshot1.x_ = 0.0;
+    snapshot1.angle_ = 0.0;
+    interpolator.addSimulationSnapshot(snapshot1);
+
+    SimulationSnapshot snapshot2;
+    snapshot2.simulation_time_ = 2000.0;
+    snapshot2.x_ = 10.0;
+    snapshot2.angle_ = 90.0;
+    interpolator.addSimulationSnapshot(snapshot2);
+
+    InterpolatedPose pose = interpolator.getInterpolatedPose(1500.0);
+
+    EXPECT_DOUBLE_EQ(pose.x_, 5.0);
+    EXPECT_DOUBLE_EQ(pose.angle_, 45.0);
+    EXPECT_DOUBLE_EQ(pose.simulation_time_, 1500.0);
+}
+
+TEST(StateInterpolatorTest, getSnapshotAtSharesSnapshotBetweenFrames) {
+    StateInterpolator interpolator;
+
+    EXPECT_EQ(interpolator.getSnapshotAt(0.0), nullptr);
+
+    SimulationSnapshot snapshot1;
+    snapshot1.simulation_time_ = 1000.0;
+    interpolator.addSimulationSnapshot(snapshot1);
+
+    SimulationSnapshot snapshot2;
+    snapshot2.simulation_time_ = 2000.0;
+    snapshot2.points_.push_back(Point(1.0, 2.0, 0));
+    interpolator.addSimulationSnapshot(snapshot2);
+
+    shared_ptr<const SimulationSnapshot> frame1 = interpolator.getSnapshotAt(1200.0);
+    shared_ptr<const SimulationSnapshot> frame2 = interpolator.getSnapshotAt(1800.0);
+
+    ASSERT_NE(frame1, nullptr);
+    EXPECT_EQ(frame1, frame2);
+    EXPECT_DOUBLE_EQ(frame1->simulation_time_, 2000.0);
+    EXPECT_EQ(frame1->points_.size(), 1u);
+}
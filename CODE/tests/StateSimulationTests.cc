@@ -20,8 +20,6 @@ TEST(ConstructorAndGetters, constructorAndGetters) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -51,8 +49,6 @@ TEST(OperatorEquals, equals) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -73,8 +69,6 @@ TEST(OperatorEquals, notEqualsLawn) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width + 1, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
@@ -96,8 +90,6 @@ TEST(OperatorNotEquals, notEqualsMower) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Mower mower2 = Mower(width + 1, length, blade_diameter, speed);
@@ -119,8 +111,6 @@ TEST(OperatorNotEquals, notEqualsLogger) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -143,8 +133,6 @@ TEST(OperatorNotEquals, notEquals) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Lawn lawn2 = Lawn(lawn_width + 1, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
@@ -166,8 +154,6 @@ TEST(OperatorNotEquals, notEqualsEquals) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -188,8 +174,6 @@ TEST(SimulateMovement, moveInsideLawn) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -220,8 +204,6 @@ TEST(SimulateMovement, moveInsideLawnCorner) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -252,8 +234,6 @@ TEST(SimulateMovement, moveOutsideLawnLine) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0.0, 0.0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -282,10 +262,8 @@ TEST(SimulateMovement, moveOutsideLawnCustomAngleCorner) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 500, 500, 45);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 500, 500, 45);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -313,10 +291,8 @@ TEST(SimulateMovement, moveOutsideLawnCustomAngle) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 500, 0, 45);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 500, 0, 45);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -344,10 +320,8 @@ TEST(SimulateMovement, moveOutsideLawnCustomAngleOver180) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 500, 500, 225);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 500, 500, 225);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -375,8 +349,6 @@ TEST(SimulateRotation, rotate) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 0);
     Lawn lawn = Lawn(lawn_width, lawn_length);
     Mower mower = Mower(width, length, blade_diameter, speed);
     Logger logger = Logger();
@@ -407,10 +379,8 @@ TEST(SimulateRotation, rotatePass360) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 270);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 270);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -439,10 +409,8 @@ TEST(SimulateRotation, rotatePass360NegativeAngle) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -471,10 +439,8 @@ TEST(SimulateRotation, invalidAngleTooBig) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -502,10 +468,8 @@ TEST(SimulateRotation, invalidAngleTooSmall) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -533,10 +497,8 @@ TEST(SimulateMowingOptionOn, turnOn) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -554,10 +516,8 @@ TEST(SimulateMovingOptionOff, turnOff) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -575,10 +535,8 @@ TEST(SimulateAddPoint, addPoint) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -597,10 +555,8 @@ TEST(SimulateAddPoint, addPointOutOfLawn) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -619,10 +575,8 @@ TEST(SimulateAddPoint, add2Points) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -642,10 +596,8 @@ TEST(SimulateDeletePoint, deletePoint) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -665,10 +617,8 @@ TEST(SimulateDeletePoint, deletePointInvalidId) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -688,10 +638,8 @@ TEST(SimulateMovementToPoint, moveToPoint) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 0, 0, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 0, 0, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -712,10 +660,8 @@ TEST(SimulateMovementToPoint, moveToPoint2) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 500, 500, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 500, 500, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -736,10 +682,8 @@ TEST(SimulateMovementToPoint, moveToPointSameX) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 500, 500, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 500, 500, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -760,10 +704,8 @@ TEST(SimulateMovementToPoint, moveToPointSameX2) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 500, 500, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 500, 500, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -784,10 +726,8 @@ TEST(SimulateMovementToPoint, moveToPointCustom) {
     unsigned int length = 100;
     unsigned int blade_diameter = 90;
     unsigned int speed = 105;
-    Config::initializeRuntimeConstants(lawn_width, lawn_length);
-    Config::initializeMowerConstants(width, length, 500, 500, 90);
     Lawn lawn = Lawn(lawn_width, lawn_length);
-    Mower mower = Mower(width, length, blade_diameter, speed);
+    Mower mower = Mower(width, length, blade_diameter, speed, 500, 500, 90);
     Logger logger = Logger();
     FileLogger fileLogger = FileLogger("example_path");
     StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
@@ -798,3 +738,43 @@ TEST(SimulateMovementToPoint, moveToPointCustom) {
     EXPECT_EQ(mower.getY(), 24);
     EXPECT_EQ(stateSimulation.getLogger().getLogs().size(), 0);
 }
+
+
+TEST(LogFilter, errorsOnlyKeepsErrors) {
+    Lawn lawn = Lawn(1000, 1000);
+    Mower mower = Mower(120, 100, 90, 105);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    stateSimulation.setLogFilter(LogFilter::createErrorsOnly());
+
+    stateSimulation.simulateAddPoint(500, 500);
+    stateSimulation.simulateMovementToPoint(0);
+    stateSimulation.logArrivalAtPoint(0);
+    stateSimulation.simulateRotation(400);
+    EXPECT_THROW(stateSimulation.simulateMovement(2000), MoveOutsideLawnError);
+
+    EXPECT_EQ(LogFilter::createErrorsOnly(), stateSimulation.getLogFilter());
+    EXPECT_EQ(2u, stateSimulation.getLogger().getLogs().size());
+    EXPECT_EQ("Invalid angle. Rotation angle must be in [-360; 360] range.", 
+        stateSimulation.getLogger().getLogs().front().getMessage());
+}
+
+
+TEST(LogFilter, errorsDisabled) {
+    Lawn lawn = Lawn(1000, 1000);
+    Mower mower = Mower(120, 100, 90, 105);
+    Logger logger = Logger();
+    FileLogger fileLogger = FileLogger("");
+    StateSimulation stateSimulation = StateSimulation(lawn, mower, logger, fileLogger);
+    LogFilter filter;
+    filter.setLevel(LogCategory::ERRORS, LogLevel::OFF);
+    stateSimulation.setLogFilter(filter);
+
+    stateSimulation.simulateRotation(400);
+    stateSimulation.simulateDeletePoint(3);
+    stateSimulation.simulateMovementToPoint(3);
+    EXPECT_THROW(stateSimulation.simulateMovement(2000), MoveOutsideLawnError);
+
+    EXPECT_EQ(0u, stateSimulation.getLogger().getLogs().size());
+}
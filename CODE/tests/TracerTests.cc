@@ -0,0 +1,105 @@
+#define MOWER_TRACING
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "../include/Tracer.h"
+
+using namespace std;
+
+
+namespace {
+    size_t countOccurrences(const string& text, const string& pattern) {
+        size_t occurrences = 0;
+        for (size_t position = text.find(pattern); position != string::npos;
+                position = text.find(pattern, position + pattern.size())) {
+            ++occurrences;
+        }
+        return occurrences;
+    }
+
+    string writeTrace() {
+        ostringstream output;
+        Tracer::getInstance().writeChromeTrace(output);
+        return output.str();
+    }
+}
+
+
+TEST(TraceBuffer, pushPublishesEvents) {
+    TraceBuffer buffer(7);
+
+    EXPECT_TRUE(buffer.push({"first", 10, 5}));
+    EXPECT_TRUE(buffer.push({"second", 20, 1}));
+
+    ASSERT_EQ(2u, buffer.getSize());
+    EXPECT_STREQ("first", buffer.getEvent(0).name_);
+    EXPECT_EQ(20u, buffer.getEvent(1).start_);
+    EXPECT_EQ(1u, buffer.getEvent(1).duration_);
+    EXPECT_EQ(7u, buffer.getThreadId());
+    EXPECT_EQ(0u, buffer.getDroppedNumber());
+}
+
+
+TEST(TraceBuffer, eventsAboveCapacityAreDropped) {
+    TraceBuffer buffer(1);
+
+    for (size_t i = 0; i < TraceBuffer::CAPACITY; ++i) {
+        ASSERT_TRUE(buffer.push({"event", i, 1}));
+    }
+    EXPECT_FALSE(buffer.push({"event", 0, 1}));
+
+    EXPECT_EQ(TraceBuffer::CAPACITY, buffer.getSize());
+    EXPECT_EQ(1u, buffer.getDroppedNumber());
+    EXPECT_EQ(TraceBuffer::CHUNK_SIZE, buffer.getEvent(TraceBuffer::CHUNK_SIZE).start_);
+}
+
+
+TEST(Tracer, traceScopeRecordsCompleteEvent) {
+    size_t events_number = Tracer::getInstance().getEventsNumber();
+    {
+        TRACE_SCOPE("TracerTests::scope");
+        this_thread::sleep_for(chrono::milliseconds(1));
+    }
+
+    EXPECT_EQ(events_number + 1, Tracer::getInstance().getEventsNumber());
+    string trace = writeTrace();
+    size_t position = trace.find("{\"name\":\"TracerTests::scope\",\"cat\":\"mower\",\"ph\":\"X\",\"ts\":");
+    ASSERT_NE(string::npos, position);
+
+    size_t duration_position = trace.find("\"dur\":", position);
+    ASSERT_NE(string::npos, duration_position);
+    EXPECT_GE(stod(trace.substr(duration_position + 6)), 1000.0); // microseconds
+}
+
+
+TEST(Tracer, threadsHaveSeparateBuffersAndNames) {
+    auto work = [](const char* thread_name) {
+        TRACE_THREAD_NAME(thread_name);
+        for (int i = 0; i < 100; ++i) {
+            TRACE_SCOPE("TracerTests::worker");
+        }
+    };
+    thread first(work, "tracer_first");
+    thread second(work, "tracer_second");
+    first.join();
+    second.join();
+
+    string trace = writeTrace();
+    EXPECT_EQ(200u, countOccurrences(trace, "\"name\":\"TracerTests::worker\""));
+    EXPECT_EQ(1u, countOccurrences(trace, "\"args\":{\"name\":\"tracer_first\"}"));
+    EXPECT_EQ(1u, countOccurrences(trace, "\"args\":{\"name\":\"tracer_second\"}"));
+    EXPECT_EQ(0u, Tracer::getInstance().getDroppedNumber());
+}
+
+
+TEST(Tracer, chromeTraceIsJsonObject) {
+    Tracer::getInstance().record("TracerTests::\"quoted\"", 1500, 4000);
+
+    string trace = writeTrace();
+    EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    EXPECT_EQ(trace.size() - 4, trace.rfind("\n]}\n"));
+    EXPECT_NE(string::npos, trace.find("\"name\":\"TracerTests::\\\"quoted\\\"\",\"cat\":\"mower\",\"ph\":\"X\","
+        "\"ts\":1.500,\"dur\":2.500"));
+    EXPECT_EQ(string::npos, trace.find(",\n]"));
+}